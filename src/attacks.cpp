@@ -18,137 +18,223 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 
 #ifdef USE_PEXT
-#include <cimmintrin>
+#include <immintrin.h>
 #endif
 
 #include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
+#include "masks.h"
 #include "types.h"
 
-uint64_t PawnAttacks[COLOUR_NB][SQUARE_NB];
-uint64_t KnightAttacks[SQUARE_NB];
-uint64_t BishopAttacks[0x1480];
-uint64_t RookAttacks[0x19000];
-uint64_t KingAttacks[SQUARE_NB];
+namespace {
 
-Magic BishopTable[SQUARE_NB];
-Magic RookTable[SQUARE_NB];
+// Every attack table is built at compile time, so that nothing needs to be
+// computed when Ethereal starts. Each builder is a constexpr version of the
+// initialization loops which used to run from main()
 
-namespace {
-int validCoordinate(int rank, int file) {
+#ifdef USE_PEXT
+typedef uint16_t SliderEntry;
+constexpr uint32_t SliderTableSize = 0x1480 + 0x19000;
+#else
+typedef uint64_t SliderEntry;
+constexpr uint32_t SliderTableSize = 0x12C0 + 0x15A00;
+#endif
+
+struct LeaperTables {
+	uint64_t pawn[COLOUR_NB][SQUARE_NB];
+	uint64_t knight[SQUARE_NB];
+	uint64_t king[SQUARE_NB];
+};
+
+struct RayTables {
+	uint64_t rays[8][SQUARE_NB];
+};
+
+struct SliderTables {
+	Magic bishop[SQUARE_NB];
+	Magic rook[SQUARE_NB];
+	SliderEntry attacks[SliderTableSize];
+	uint32_t size;
+	bool collided; // Two occupancies with different attacks shared an index
+};
+
+static_assert(sizeof(Magic) <= 24, "Magic should fit in 24 bytes");
+
+constexpr int validCoordinate(int rank, int file) {
 	return 0 <= rank && rank < RANK_NB
 		&& 0 <= file && file < FILE_NB;
 }
-inline void setSquare(uint64_t& bb, int rank, int file) {
+constexpr void setSquare(uint64_t& bb, int rank, int file) {
 	if (validCoordinate(rank, file))
 		bb |= 1ull << square(rank, file);
 }
-int sliderIndex(uint64_t occupied, Magic& table) {
-#ifdef USE_PEXT
-	return _pext_u64(occupied, table.mask);
-#else
-	return ((occupied & table.mask) * table.magic) >> table.shift;
-#endif
-}
-uint64_t sliderAttacks(int sq, uint64_t occupied, const int delta[4][2]) {
+constexpr LeaperTables buildLeaperTables() {
 
-	int rank, file, dr, df;
-	uint64_t result = 0ull;
+	const int PawnDelta[2][2]   = {{ 1,-1}, { 1, 1}};
+	const int KnightDelta[8][2] = {{-2,-1}, {-2, 1}, {-1,-2}, {-1, 2},{ 1,-2}, { 1, 2}, { 2,-1}, { 2, 1}};
+	const int KingDelta[8][2]   = {{-1,-1}, {-1, 0}, {-1, 1}, { 0,-1},{ 0, 1}, { 1,-1}, { 1, 0}, { 1, 1}};
+
+	LeaperTables tables = {};
+
+	for (int sq = 0; sq < SQUARE_NB; ++sq) {
+		for (int dir = 0; dir < 2; ++dir) {
+			setSquare(tables.pawn[WHITE][sq], rankOf(sq) + PawnDelta[dir][0], fileOf(sq) + PawnDelta[dir][1]);
+			setSquare(tables.pawn[BLACK][sq], rankOf(sq) - PawnDelta[dir][0], fileOf(sq) - PawnDelta[dir][1]);
+		}
+		for (int dir = 0; dir < 8; ++dir) {
+			setSquare(tables.knight[sq], rankOf(sq) + KnightDelta[dir][0], fileOf(sq) + KnightDelta[dir][1]);
+			setSquare(tables.king[sq],   rankOf(sq) +   KingDelta[dir][0], fileOf(sq) +   KingDelta[dir][1]);
+		}
+	}
+
+	return tables;
+}
+constexpr RayTables buildRayTables() {
 
-	for (int i = 0; i < 4; ++i) {
+	// Directions 0-3 head towards higher squares, and 4-7 towards lower squares.
+	// Bishops use the directions {0, 1, 4, 5}, and Rooks use {2, 3, 6, 7}
+	const int RayDelta[8][2] = {{ 1,-1}, { 1, 1}, { 1, 0}, { 0, 1}, {-1,-1}, {-1, 1}, {-1, 0}, { 0,-1}};
 
-		dr = delta[i][0], df = delta[i][1];
+	RayTables tables = {};
 
-		for (rank = rankOf(sq) + dr, file = fileOf(sq) + df; validCoordinate(rank, file); rank += dr, file += df) {
-				setBit(result, square(rank, file));
-				if (testBit(occupied, square(rank, file)))
-					break;
+	for (int dir = 0; dir < 8; ++dir) {
+		for (int sq = 0; sq < SQUARE_NB; ++sq) {
+			int rank = rankOf(sq) + RayDelta[dir][0], file = fileOf(sq) + RayDelta[dir][1];
+			for (; validCoordinate(rank, file); rank += RayDelta[dir][0], file += RayDelta[dir][1])
+			setSquare(tables.rays[dir][sq], rank, file);
 		}
 	}
 
+	return tables;
+}
+
+constexpr LeaperTables Leapers = buildLeaperTables();
+constexpr RayTables Rays = buildRayTables();
+
+constexpr uint64_t rayAttacks(int dir, int sq, uint64_t occupied) {
+
+	// Cut the ray off behind the first blocker in the direction of travel
+	const uint64_t blockers = Rays.rays[dir][sq] & occupied;
+
+	return !blockers ? Rays.rays[dir][sq]
+		 : Rays.rays[dir][sq] ^ Rays.rays[dir][dir < 4 ? getlsb(blockers) : getmsb(blockers)];
+}
+constexpr uint64_t sliderAttacks(int sq, uint64_t occupied, int piece) {
+	const int first = piece == BISHOP ? 0 : 2;
+	return rayAttacks(first + 0, sq, occupied) | rayAttacks(first + 1, sq, occupied)
+		 | rayAttacks(first + 4, sq, occupied) | rayAttacks(first + 5, sq, occupied);
+}
+#ifdef USE_PEXT
+constexpr uint64_t softwarePext(uint64_t bits, uint64_t mask) {
+
+	// Portable version of _pext_u64(), since intrinsics are not constexpr
+	uint64_t result = 0ull;
+
+	for (uint64_t bit = 1ull; mask; mask &= mask - 1, bit <<= 1)
+		if (bits & mask & (~mask + 1))
+			result |= bit;
+
 	return result;
 }
-void initSliderAttacks(int sq, Magic *const table, uint64_t magic, const int delta[4][2]) {
+int sliderIndex(uint64_t occupied, const Magic& table) {
+	return _pext_u64(occupied, table.mask);
+}
+#else
+constexpr int sliderIndex(uint64_t occupied, const Magic& table) {
+	return ((occupied & table.mask) * table.magic) >> table.shift;
+}
+#endif
+constexpr void initSliderAttacks(SliderTables& tables, Magic& table, int sq, int piece, uint64_t magic, int bits) {
 
-	uint64_t edges = ((RANK_1 | RANK_8) & ~Ranks[rankOf(sq)])
-						| ((FILE_A | FILE_H) & ~Files[fileOf(sq)]);
+	const uint64_t edges = ((RANK_1 | RANK_8) & ~(uint64_t(RANK_1) << (8 * rankOf(sq))))
+						 | ((FILE_A | FILE_H) & ~(uint64_t(FILE_A) << fileOf(sq)));
 
 	uint64_t occupied = 0ull;
+	uint32_t index = 0u;
 
 	// Init entry for the given square
-	table[sq].magic = magic;
-	table[sq].mask  = sliderAttacks(sq, 0, delta) & ~edges;
-	table[sq].shift = 64 - popcount(table[sq].mask);
+#ifdef USE_PEXT
+	(void)magic; // Not needed when indexing with PEXT
+	table.attacks = sliderAttacks(sq, 0ull, piece);
+	table.mask    = table.attacks & ~edges;
+	bits          = popcount(table.mask);
+#else
+	table.magic = magic;
+	table.mask  = sliderAttacks(sq, 0ull, piece) & ~edges;
+	table.shift = 64 - bits;
+#endif
 
 	// Track the offset as we use up the table
-	if (sq != SQUARE_NB - 1)
-		table[sq+1].offset = table[sq].offset + (1 << popcount(table[sq].mask));
+	table.offset = tables.size;
+	tables.size += 1u << bits;
 
 	do { // Init attacks for all occupancy variations
-		int index = sliderIndex(occupied, table[sq]);
-		table[sq].offset[index] = sliderAttacks(sq, occupied, delta);
-		occupied = (occupied - table[sq].mask) & table[sq].mask;
+
+#ifdef USE_PEXT
+		// Walking the subsets of the mask in this manner visits them in
+		// exactly the order of their PEXT index, which we simply count
+		tables.attacks[table.offset + index++] = softwarePext(sliderAttacks(sq, occupied, piece), table.attacks);
+#else
+		// Shortened indices rely on collisions being constructive. A bad
+		// Magic is flagged here, and rejected when the tables are compiled
+		index = sliderIndex(occupied, table);
+		tables.collided |=  tables.attacks[table.offset + index]
+						&&  tables.attacks[table.offset + index] != sliderAttacks(sq, occupied, piece);
+		tables.attacks[table.offset + index] = sliderAttacks(sq, occupied, piece);
+#endif
+
+		occupied = (occupied - table.mask) & table.mask;
 	} while (occupied);
 }
-}
+constexpr SliderTables buildSliderTables() {
 
-void initAttacks() {
+	SliderTables tables = {};
 
-	const int PawnDelta[2][2]   = {{ 1,-1}, { 1, 1}};
-	const int KnightDelta[8][2] = {{-2,-1}, {-2, 1}, {-1,-2}, {-1, 2},{ 1,-2}, { 1, 2}, { 2,-1}, { 2, 1}};
-	const int KingDelta[8][2]   = {{-1,-1}, {-1, 0}, {-1, 1}, { 0,-1},{ 0, 1}, { 1,-1}, { 1, 0}, { 1, 1}};
-	const int BishopDelta[4][2] = {{-1,-1}, {-1, 1}, { 1,-1}, { 1, 1}};
-	const int RookDelta[4][2]   = {{-1, 0}, { 0,-1}, { 0, 1}, { 1, 0}};
+	for (int sq = 0; sq < SQUARE_NB; ++sq) {
+		initSliderAttacks(tables, tables.bishop[sq], sq, BISHOP, BishopMagics[sq], BishopIndexBits[sq]);
+		initSliderAttacks(tables, tables.rook[sq],   sq,   ROOK,   RookMagics[sq],   RookIndexBits[sq]);
+	}
 
-	// First square has initial offset
-	BishopTable[0].offset = BishopAttacks;
-	RookTable[0].offset = RookAttacks;
+	return tables;
+}
 
-	// Init attack tables for Pawns
-	for (int sq = 0; sq < 64; ++sq) {
-		for (int dir = 0; dir < 2; ++dir) {
-				setSquare(PawnAttacks[WHITE][sq], rankOf(sq) + PawnDelta[dir][0], fileOf(sq) + PawnDelta[dir][1]);
-				setSquare(PawnAttacks[BLACK][sq], rankOf(sq) - PawnDelta[dir][0], fileOf(sq) - PawnDelta[dir][1]);
-		}
-	}
+constexpr SliderTables Sliders = buildSliderTables();
 
-	// Init attack tables for Knights & Kings
-	for (int sq = 0; sq < 64; ++sq) {
-		for (int dir = 0; dir < 8; ++dir) {
-				setSquare(KnightAttacks[sq], rankOf(sq) + KnightDelta[dir][0], fileOf(sq) + KnightDelta[dir][1]);
-				setSquare( KingAttacks[sq], rankOf(sq) +   KingDelta[dir][0], fileOf(sq) +   KingDelta[dir][1]);
-		}
-	}
+static_assert(Sliders.size == SliderTableSize, "Slider attack table size mismatch");
+static_assert(!Sliders.collided, "Slider attack table has a destructive Magic collision");
 
-	// Init attack tables for sliding pieces
-	for (int sq = 0; sq < 64; ++sq) {
-		initSliderAttacks(sq, BishopTable, BishopMagics[sq], BishopDelta);
-		initSliderAttacks(sq,   RookTable,   RookMagics[sq],   RookDelta);
-	}
+uint64_t sliderLookup(uint64_t occupied, const Magic& table) {
+#ifdef USE_PEXT
+	return _pdep_u64(Sliders.attacks[table.offset + sliderIndex(occupied, table)], table.attacks);
+#else
+	return Sliders.attacks[table.offset + sliderIndex(occupied, table)];
+#endif
+}
 }
 
 uint64_t pawnAttacks(int colour, int sq) {
 	assert(0 <= colour && colour < COLOUR_NB);
 	assert(0 <= sq && sq < SQUARE_NB);
-	return PawnAttacks[colour][sq];
+	return Leapers.pawn[colour][sq];
 }
 
 uint64_t knightAttacks(int sq) {
 	assert(0 <= sq && sq < SQUARE_NB);
-	return KnightAttacks[sq];
+	return Leapers.knight[sq];
 }
 
 uint64_t bishopAttacks(int sq, uint64_t occupied) {
 	assert(0 <= sq && sq < SQUARE_NB);
-	return BishopTable[sq].offset[sliderIndex(occupied, BishopTable[sq])];
+	return sliderLookup(occupied, Sliders.bishop[sq]);
 }
 
 uint64_t rookAttacks(int sq, uint64_t occupied) {
 	assert(0 <= sq && sq < SQUARE_NB);
-	return RookTable[sq].offset[sliderIndex(occupied, RookTable[sq])];
+	return sliderLookup(occupied, Sliders.rook[sq]);
 }
 
 uint64_t queenAttacks(int sq, uint64_t occupied) {
@@ -158,7 +244,7 @@ uint64_t queenAttacks(int sq, uint64_t occupied) {
 
 uint64_t kingAttacks(int sq) {
 	assert(0 <= sq && sq < SQUARE_NB);
-	return KingAttacks[sq];
+	return Leapers.king[sq];
 }
 
 uint64_t pawnLeftAttacks(uint64_t pawns, uint64_t targets, int colour) {
@@ -186,6 +272,10 @@ uint64_t pawnEnpassCaptures(uint64_t pawns, int epsq, int colour) {
 
 int squareIsAttacked(Board& board, int colour, int sq) {
 
+#ifdef USE_ATTACK_MAPS
+	return testBit(attackedSquares(board, !colour), sq);
+#endif
+
 	uint64_t enemy    = board.colours[!colour];
 	uint64_t occupied = board.colours[ colour] | enemy;
 
@@ -242,5 +332,182 @@ uint64_t attackersToKingSquare(Board& board) {
 
 	// Wrapper for attackersToSquare() for use in check detection
 	int kingsq = getlsb(board.colours[board.turn] & board.pieces[KING]);
+
+#ifdef USE_ATTACK_MAPS
+	// The maps settle the common case of not being in check at all
+	if (!testBit(attackedSquares(board, !board.turn), kingsq))
+		return 0ull;
+#endif
+
 	return attackersToSquare(board, board.turn, kingsq);
 }
+
+size_t sliderTableBytes() {
+	return sizeof(Sliders.attacks) + sizeof(Sliders.bishop) + sizeof(Sliders.rook);
+}
+
+const void *sliderTableEntry(int piece, int sq, uint64_t occupied) {
+	const Magic& table = piece == BISHOP ? Sliders.bishop[sq] : Sliders.rook[sq];
+	return &Sliders.attacks[table.offset + sliderIndex(occupied, table)];
+}
+
+uint64_t pinnedPieces(Board& board, int colour) {
+
+	uint64_t friendly = board.colours[ colour];
+	uint64_t enemy    = board.colours[!colour];
+	uint64_t occupied = friendly | enemy;
+
+	int kingsq = getlsb(friendly & board.pieces[KING]);
+	uint64_t pinned = 0ull, between;
+
+	// Find enemy sliders which would attack our King if only our own pieces
+	// were removed. A piece is pinned if it is the only blocker on that ray
+	uint64_t sliders = (bishopAttacks(kingsq, enemy) & enemy & (board.pieces[BISHOP] | board.pieces[QUEEN]))
+					 | (rookAttacks(kingsq, enemy) & enemy & (board.pieces[ROOK] | board.pieces[QUEEN]));
+
+	while (sliders) {
+		between = bitsBetweenMasks(kingsq, poplsb(sliders)) & occupied;
+		if (onlyOne(between) && (between & friendly))
+			pinned |= between;
+	}
+
+	return pinned;
+}
+
+#ifdef USE_ATTACK_MAPS
+
+namespace {
+
+// The attack maps count, for each colour and square, how many Knights,
+// Bishops, Rooks, Queens and Kings attack that square. Pawns are left out,
+// since their attacks are only a pair of shifts away. A move only changes
+// the attacks of the pieces on the squares it touches, and of the sliders
+// which see one of those squares, so only those pieces are updated
+
+void addAttacks(uint64_t *planes, uint64_t attacks) {
+
+	// Ripple carry addition of one to every square in attacks
+	for (int i = 0; attacks && i < ATTACK_PLANES; i++) {
+		uint64_t carry = planes[i] & attacks;
+		planes[i] ^= attacks, attacks = carry;
+	}
+
+	assert(!attacks);
+}
+
+void removeAttacks(uint64_t *planes, uint64_t attacks) {
+
+	// Ripple borrow subtraction of one from every square in attacks
+	for (int i = 0; attacks && i < ATTACK_PLANES; i++) {
+		uint64_t borrow = ~planes[i] & attacks;
+		planes[i] ^= attacks, attacks = borrow;
+	}
+
+	assert(!attacks);
+}
+
+uint64_t mappedAttacks(int piece, int sq, uint64_t occupied) {
+
+	switch (pieceType(piece)) {
+		case KNIGHT : return knightAttacks(sq);
+		case BISHOP : return bishopAttacks(sq, occupied);
+		case ROOK   : return rookAttacks(sq, occupied);
+		case QUEEN  : return queenAttacks(sq, occupied);
+		case KING   : return kingAttacks(sq);
+		default     : return 0ull;
+	}
+}
+
+void buildAttackMaps(Board& board, uint64_t maps[COLOUR_NB][ATTACK_PLANES]) {
+
+	uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
+	uint64_t pieces   = occupied & ~board.pieces[PAWN];
+
+	memset(maps, 0, sizeof(uint64_t) * COLOUR_NB * ATTACK_PLANES);
+
+	while (pieces) {
+		int sq = poplsb(pieces), piece = board.squares[sq];
+		addAttacks(maps[pieceColour(piece)], mappedAttacks(piece, sq, occupied));
+	}
+}
+
+}
+
+void initAttackMaps(Board& board) {
+	buildAttackMaps(board, board.attackMaps);
+}
+
+uint64_t liftAttackMaps(Board& board, uint64_t changed) {
+
+	// Called before a move is applied, with every square whose contents will
+	// change. Removes the attacks of each piece which the move may affect,
+	// and returns those which will remain in place, to be added back later
+
+	uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
+	uint64_t bishops  = board.pieces[BISHOP] | board.pieces[QUEEN];
+	uint64_t rooks    = board.pieces[ROOK  ] | board.pieces[QUEEN];
+	uint64_t affected = changed & occupied & ~board.pieces[PAWN];
+
+	for (uint64_t squares = changed; squares; ) {
+		int sq = poplsb(squares);
+		affected |= (bishopAttacks(sq, occupied) & bishops)
+				 |  (rookAttacks(sq, occupied) & rooks);
+	}
+
+	for (uint64_t pieces = affected; pieces; ) {
+		int sq = poplsb(pieces), piece = board.squares[sq];
+		removeAttacks(board.attackMaps[pieceColour(piece)], mappedAttacks(piece, sq, occupied));
+	}
+
+	return affected & ~changed;
+}
+
+void dropAttackMaps(Board& board, uint64_t changed, uint64_t lifted) {
+
+	// Called once the move has been applied. Adds back the attacks of the
+	// sliders which were lifted, and those of the pieces now on the changed
+	// squares, each with the new occupancy
+
+	uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
+	uint64_t pieces   = lifted | (changed & occupied & ~board.pieces[PAWN]);
+
+	while (pieces) {
+		int sq = poplsb(pieces), piece = board.squares[sq];
+		addAttacks(board.attackMaps[pieceColour(piece)], mappedAttacks(piece, sq, occupied));
+	}
+}
+
+uint64_t attackedSquares(Board& board, int colour) {
+
+	uint64_t attacked = pawnAttackSpan(board.colours[colour] & board.pieces[PAWN], allON, colour);
+
+	for (int i = 0; i < ATTACK_PLANES; i++)
+		attacked |= board.attackMaps[colour][i];
+
+	return attacked;
+}
+
+uint64_t attackedTwiceSquares(Board& board, int colour) {
+
+	// Squares attacked by two pieces, counting all Pawns as a single piece
+	// to match the definition used by the evaluation
+
+	uint64_t pawns  = pawnAttackSpan(board.colours[colour] & board.pieces[PAWN], allON, colour);
+	uint64_t once   = board.attackMaps[colour][0];
+	uint64_t twice  = 0ull;
+
+	for (int i = 1; i < ATTACK_PLANES; i++)
+		twice |= board.attackMaps[colour][i];
+
+	return twice | (pawns & (once | twice));
+}
+
+int attackMapsAreValid(Board& board) {
+
+	// Debugging check that the incremental maps match a fresh computation
+	uint64_t maps[COLOUR_NB][ATTACK_PLANES];
+	buildAttackMaps(board, maps);
+	return !memcmp(maps, board.attackMaps, sizeof(maps));
+}
+
+#endif
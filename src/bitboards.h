@@ -53,22 +53,22 @@ extern const uint64_t Files[FILE_NB];
 extern const uint64_t Ranks[RANK_NB];
 
 
-inline bool testBit(uint64_t bb, int i) {
+constexpr bool testBit(uint64_t bb, int i) {
 	assert(0 <= i && i < SQUARE_NB);
 	return bb & (1ull << i);
 }
 
-inline int getlsb(uint64_t bb) {
+constexpr int getlsb(uint64_t bb) {
 	assert(bb);  // lsb(0) is undefined
 	return __builtin_ctzll(bb);
 }
 
-inline int getmsb(uint64_t bb) {
+constexpr int getmsb(uint64_t bb) {
 	assert(bb);  // msb(0) is undefined
 	return __builtin_clzll(bb) ^ 63;
 }
 
-inline int fileOf(int sq) {
+constexpr int fileOf(int sq) {
 	assert(0 <= sq && sq < SQUARE_NB);
 	return sq % FILE_NB;
 }
@@ -79,18 +79,18 @@ inline int mirrorFile(int file) {
 	return Mirror[file];
 }
 
-inline int rankOf(int sq) {
+constexpr int rankOf(int sq) {
 	assert(0 <= sq && sq < SQUARE_NB);
 	return sq / FILE_NB;
 }
 
-inline int relativeRankOf(int colour, int sq) {
+constexpr int relativeRankOf(int colour, int sq) {
 	assert(0 <= colour && colour < COLOUR_NB);
 	assert(0 <= sq && sq < SQUARE_NB);
 	return colour == WHITE ? rankOf(sq) : 7 - rankOf(sq);
 }
 
-inline int square(int rank, int file) {
+constexpr int square(int rank, int file) {
 	assert(0 <= rank && rank < RANK_NB);
 	assert(0 <= file && file < FILE_NB);
 	return rank * FILE_NB + file;
@@ -116,7 +116,7 @@ inline int backmost(int colour, uint64_t b) {
 	return colour == WHITE ? getlsb(b) : getmsb(b);
 }
 
-inline int popcount(uint64_t bb) {
+constexpr int popcount(uint64_t bb) {
 	return __builtin_popcountll(bb);
 }
 
@@ -132,11 +132,11 @@ inline int popmsb(uint64_t& bb) {
 	return msb;
 }
 
-inline bool several(uint64_t bb) {
+constexpr bool several(uint64_t bb) {
 	return bb & (bb - 1);
 }
 
-inline bool onlyOne(uint64_t bb) {
+constexpr bool onlyOne(uint64_t bb) {
 	return bb && !several(bb);
 }
 
@@ -16,19 +16,39 @@
 	along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
+#include <chrono>
+#include <cmath>
 #include <cinttypes>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <spawn.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
+#include "endgame.h"
 #include "evaluate.h"
 #include "masks.h"
 #include "move.h"
 #include "movegen.h"
+#include "packed.h"
 #include "search.h"
 #include "thread.h"
 #include "time.h"
@@ -61,17 +81,92 @@ void setSquare(Board& board, int colour, int piece, int sq) {
 	setBit(board.pieces[piece], sq);
 
 	board.psqtmat += PSQT[board.squares[sq]][sq];
+	board.materialKey += MaterialKeys[board.squares[sq]];
 	board.hash ^= ZobristKeys[board.squares[sq]][sq];
 	if (piece == PAWN || piece == KING)
 		board.pkhash ^= ZobristKeys[board.squares[sq]][sq];
 }
-int stringToSquare(string& str) {
 
-	// Helper for reading the enpass square from a FEN. If no square
-	// is provided, Ethereal will use -1 to represent this internally
+void finishBoard(Board& board, int chess960) {
 
-	return str[0] == '-' ? -1 : square(str[1] - '1', str[0] - 'a');
+	// Complete a Board whose pieces, turn, castle rooks, enpass square and
+	// counters have been set, by hashing the latter and finding the checks
+
+	static const uint64_t StandardCastles = (1ull <<  0) | (1ull <<  7)
+										  | (1ull << 56) | (1ull << 63);
+
+	uint64_t rooks = board.castleRooks;
+
+	if (board.turn == BLACK) board.hash ^= ZobristTurnKey;
+	while (rooks) board.hash ^= ZobristCastleKeys[poplsb(rooks)];
+	if (board.epSquare != -1)
+		board.hash ^= ZobristEnpassKeys[fileOf(board.epSquare)];
+
+	// Move count: ignore and use zero, as we count since root
+	board.numMoves = 0;
+
+#ifdef USE_ATTACK_MAPS
+	initAttackMaps(board);
+#endif
+
+	// Need king attackers and pins for move generation
+	board.kingAttackers = attackersToKingSquare(board);
+	board.pinned = pinnedPieces(board, board.turn);
+
+	// We save the game mode in order to comply with the UCI rules for printing
+	// moves. If chess960 is not enabled, but we have detected an unconventional
+	// castle setup, then we set chess960 to be true on our own. Currently, this
+	// is simply a hack so that FRC positions may be added to the bench.csv
+	board.chess960 = chess960 || (board.castleRooks & ~StandardCastles);
 }
+struct CacheCounters {
+
+	// Hardware counters for L1 data cache read misses and last level cache
+	// misses, read through perf_event_open(). Virtual machines and restrictive
+	// perf_event_paranoid settings often hide them, so they are optional
+
+	int fds[2] = {-1, -1};
+
+	CacheCounters() {
+	#ifdef __linux__
+		const uint32_t types[2] = { PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE };
+		const uint64_t configs[2] = {
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+			PERF_COUNT_HW_CACHE_MISSES,
+		};
+		for (int i = 0; i < 2; ++i) {
+			perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr), attr.type = types[i], attr.config = configs[i];
+			attr.disabled = 1, attr.exclude_kernel = 1, attr.exclude_hv = 1;
+			fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+		}
+	#endif
+	}
+
+	~CacheCounters() {
+	#ifdef __linux__
+		for (int fd : fds) if (fd >= 0) close(fd);
+	#endif
+	}
+
+	bool available() { return fds[0] >= 0 && fds[1] >= 0; }
+
+	void start() {
+	#ifdef __linux__
+		for (int fd : fds) if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_RESET, 0), ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	#endif
+	}
+
+	void stop(uint64_t counts[2]) {
+		counts[0] = counts[1] = 0ull;
+	#ifdef __linux__
+		for (int i = 0; i < 2; ++i)
+			if (fds[i] >= 0 && (ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0), read(fds[i], &counts[i], sizeof(uint64_t))) != sizeof(uint64_t))
+				counts[i] = 0ull;
+	#endif
+	}
+};
 }
 
 void squareToString(int sq, char *str) {
@@ -92,29 +187,35 @@ void squareToString(int sq, char *str) {
 	*str = 0;
 }
 
-void boardFromFEN(Board& board,const string& fens, int chess960) {
+void boardFromFEN(Board& board, const string& fen, int chess960) {
+	boardFromFEN(board, fen.c_str(), chess960);
+}
 
-	static const uint64_t StandardCastles = (1ull <<  0) | (1ull <<  7)
-														| (1ull << 56) | (1ull << 63);
+void boardFromFEN(Board& board, const char *fen, int chess960) {
 
 	int sq = 56;
-	char ch;
-	string word(43,0), fen=fens;
-	uint64_t rooks, kings, white, black;
+	const char *str = fen;
+	uint64_t rooks, white, black;
+
+	// The FEN is read in place, one field at a time, without any copies
+	auto nextField = [&]() {
+		while (*str && !isspace(*str)) str++;
+		while (*str &&  isspace(*str)) str++;
+	};
 
 	board(); // Zero out, set squares to EMPTY
 
-	parse(fen, word);
-	uint16_t i=0;
+	while (isspace(*str)) str++;
+
 	// Piece placement
-	while ((ch = word[i++])) {
-		if (isdigit(ch))
-				sq += ch - '0';
-		else if (ch == '/')
+	for (; *str && !isspace(*str); ++str) {
+		if (isdigit(*str))
+				sq += *str - '0';
+		else if (*str == '/')
 				sq -= 16;
 		else {
-				const bool colour = islower(ch);
-				const char *piece = strchr(PieceLabel[colour], ch);
+				const bool colour = islower(*str);
+				const char *piece = strchr(PieceLabel[colour], *str);
 
 				if (piece)
 					setSquare(board, colour, piece - PieceLabel[colour], sq++);
@@ -122,62 +223,41 @@ void boardFromFEN(Board& board,const string& fens, int chess960) {
 	}
 
 	// Turn of play
-	parse(fen, word);
-	board.turn = word[0] == 'w' ? WHITE : BLACK;
-	if (board.turn == BLACK) board.hash ^= ZobristTurnKey;
+	nextField();
+	board.turn = *str == 'w' ? WHITE : BLACK;
 
 	// Castling rights
-	parse(fen, word);
+	nextField();
 
 	rooks = board.pieces[ROOK];
-	kings = board.pieces[KING];
 	white = board.colours[WHITE];
 	black = board.colours[BLACK];
-	i=0;
-	while ((ch = word[i++])) {
-		switch(ch) {
+
+	for (; *str && !isspace(*str); ++str) {
+		switch(*str) {
 		case 'K': setBit(board.castleRooks, getmsb(white & rooks & RANK_1)); break;
 		case 'Q': setBit(board.castleRooks, getlsb(white & rooks & RANK_1));  break;
 		case 'k': setBit(board.castleRooks, getmsb(black & rooks & RANK_8)); break;
 		case 'q': setBit(board.castleRooks, getlsb(black & rooks & RANK_8));   break;
 		default:
-		if ('A' <= ch && ch <= 'H') setBit(board.castleRooks, square(0, ch - 'A'));
-		else if ('a' <= ch && ch <= 'h') setBit(board.castleRooks, square(7, ch - 'a'));
+		if ('A' <= *str && *str <= 'H') setBit(board.castleRooks, square(0, *str - 'A'));
+		else if ('a' <= *str && *str <= 'h') setBit(board.castleRooks, square(7, *str - 'a'));
 		break;
 		}
 	}
 
-	for (sq = 0; sq < SQUARE_NB; ++sq) {
-		board.castleMasks[sq] = allON;
-		if (testBit(board.castleRooks, sq)) clearBit(board.castleMasks[sq], sq);
-		if (testBit(white & kings, sq)) board.castleMasks[sq] &= ~white;
-		if (testBit(black & kings, sq)) board.castleMasks[sq] &= ~black;
-	}
-
-	rooks = board.castleRooks;
-	while (rooks) board.hash ^= ZobristCastleKeys[poplsb(rooks)];
-
 	// En passant square
-	board.epSquare = stringToSquare(parse(fen, word));
-	if (board.epSquare != -1)
-		board.hash ^= ZobristEnpassKeys[fileOf(board.epSquare)];
-
-	// Half & Full Move Counters
-	board.halfMoveCounter = stoi(parse(fen, word));
-	board.fullMoveCounter = stoi(parse(fen, word));
-
-	// Move count: ignore and use zero, as we count since root
-	board.numMoves = 0;
+	nextField();
+	board.epSquare = ('a' <= str[0] && str[0] <= 'h' && '1' <= str[1] && str[1] <= '8')
+				   ? square(str[1] - '1', str[0] - 'a') : -1;
 
-	// Need king attackers for move generation
-	board.kingAttackers = attackersToKingSquare(board);
-
-	// We save the game mode in order to comply with the UCI rules for printing
-	// moves. If chess960 is not enabled, but we have detected an unconventional
-	// castle setup, then we set chess960 to be true on our own. Currently, this
-	// is simply a hack so that FRC positions may be added to the bench.csv
-	board.chess960 = chess960 || (board.castleRooks & ~StandardCastles);
+	// Half & Full Move Counters. EPDs and "fen ... moves" may leave them out
+	nextField();
+	board.halfMoveCounter = isdigit(*str) ? strtol(str, nullptr, 10) : 0;
+	if (isdigit(*str)) nextField();
+	board.fullMoveCounter = isdigit(*str) ? strtol(str, nullptr, 10) : 1;
 
+	finishBoard(board, chess960);
 }
 
 void boardToFEN(Board& board, string& fen) {
@@ -187,6 +267,8 @@ void boardToFEN(Board& board, string& fen) {
 	uint64_t castles;
 	uint16_t i=0, cnt;
 
+	fen.resize(128); // Longer than any FEN we may write
+
 	// Piece placement
 	for (int r = RANK_NB-1; r >= 0; --r) {
 		cnt = 0;
@@ -239,7 +321,70 @@ void boardToFEN(Board& board, string& fen) {
 
 	// En passant square, Half Move Counter, and Full Move Counter
 	squareToString(board.epSquare, str);
-	sprintf(&fen[0], " %s %d %d", str, board.halfMoveCounter, board.fullMoveCounter);
+	fen.resize(i + sprintf(&fen[i], " %s %d %d", str, board.halfMoveCounter, board.fullMoveCounter));
+}
+
+void packBoard(Board& board, PackedBoard& packed) {
+
+	// Each occupied square, from A1 upwards, gets a 4-bit code. Pieces are
+	// coded as 2 * type + colour, with extra codes for the Rooks which may
+	// still castle, and for a Pawn which may be captured en passant
+
+	uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
+	int enpass = board.epSquare == -1 ? -1 : board.epSquare + (board.turn == WHITE ? -8 : 8);
+
+	memset(&packed, 0, sizeof(PackedBoard));
+	packed.occupied = occupied;
+
+	for (int i = 0; occupied; ++i) {
+
+		const int sq = poplsb(occupied);
+		const int colour = pieceColour(board.squares[sq]);
+
+		int code = 2 * pieceType(board.squares[sq]) + colour;
+		if (testBit(board.castleRooks, sq)) code = PACKED_CASTLE_ROOK + colour;
+		if (sq == enpass) code = PACKED_ENPASS_PAWN;
+
+		packed.pieces[i / 2] |= code << (4 * (i % 2));
+	}
+
+	packed.flags           = board.turn | MIN(board.halfMoveCounter, 127) << 1;
+	packed.fullMoveCounter = board.fullMoveCounter;
+	packed.result          = PACKED_NO_RESULT;
+	packed.score           = VALUE_NONE;
+	packed.move            = NONE_MOVE;
+}
+
+void unpackBoard(Board& board, const PackedBoard& packed, int chess960) {
+
+	uint64_t occupied = packed.occupied;
+
+	board(); // Zero out, set squares to EMPTY
+
+	board.turn            = packed.flags & 1;
+	board.halfMoveCounter = packed.flags >> 1;
+	board.fullMoveCounter = packed.fullMoveCounter;
+	board.epSquare        = -1;
+
+	for (int i = 0; occupied; ++i) {
+
+		const int sq   = poplsb(occupied);
+		const int code = (packed.pieces[i / 2] >> (4 * (i % 2))) & 15;
+
+		if (code == PACKED_ENPASS_PAWN) {
+			setSquare(board, !board.turn, PAWN, sq);
+			board.epSquare = sq + (board.turn == WHITE ? 8 : -8);
+		}
+
+		else if ((code & ~1) == PACKED_CASTLE_ROOK) {
+			setSquare(board, code - PACKED_CASTLE_ROOK, ROOK, sq);
+			setBit(board.castleRooks, sq);
+		}
+
+		else setSquare(board, code % 2, code / 2, sq);
+	}
+
+	finishBoard(board, chess960);
 }
 
 void printBoard(Board& board) {
@@ -276,6 +421,19 @@ void printBoard(Board& board) {
 	cout << "\n" << fen << "\n\n";
 }
 
+void reserveRepetitionStack(RepetitionStack& stack, int size) {
+
+	// Grow geometrically, so that a long game costs few reallocations
+	if (size <= stack.capacity) return;
+	stack.capacity = MAX(size, 2 * stack.capacity);
+	stack.keys = (uint64_t*)realloc(stack.keys, sizeof(uint64_t) * stack.capacity);
+}
+
+void deleteRepetitionStack(RepetitionStack& stack) {
+	free(stack.keys);
+	stack.keys = nullptr, stack.capacity = 0;
+}
+
 int boardHasNonPawnMaterial(Board& board, int turn) {
 	uint64_t friendly = board.colours[turn];
 	uint64_t kings = board.pieces[KING];
@@ -283,11 +441,11 @@ int boardHasNonPawnMaterial(Board& board, int turn) {
 	return (friendly & (kings | pawns)) != friendly;
 }
 
-int boardIsDrawn(Board& board, int height) {
+int boardIsDrawn(Board& board, const uint64_t *keys, int height) {
 
 	// Drawn if any of the three possible cases
 	return boardDrawnByFiftyMoveRule(board)
-		|| boardDrawnByRepetition(board, height)
+		|| boardDrawnByRepetition(board, keys, height)
 		|| boardDrawnByInsufficientMaterial(board);
 }
 
@@ -299,7 +457,7 @@ int boardDrawnByFiftyMoveRule(Board& board) {
 	return board.halfMoveCounter > 99;
 }
 
-int boardDrawnByRepetition(Board& board, int height) {
+int boardDrawnByRepetition(Board& board, const uint64_t *keys, int height) {
 
 	int reps = 0;
 
@@ -312,7 +470,7 @@ int boardDrawnByRepetition(Board& board, int height) {
 
 		// Check for matching hash with a two fold after the root,
 		// or a three fold which occurs in part before the root move
-		if (    board.history[i] == board.hash
+		if (    keys[i] == board.hash
 				&& (i > board.numMoves - height || ++reps == 2))
 				return 1;
 	}
@@ -320,37 +478,42 @@ int boardDrawnByRepetition(Board& board, int height) {
 	return 0;
 }
 
-int boardDrawnByInsufficientMaterial(Board& board) {
-
-	// Check for KvK, KvN, KvB, and KvNN.
+int boardHasUpcomingRepetition(Board& board, const uint64_t *keys, int height, int pliesFromNull) {
 
-	return !(board.pieces[PAWN] | board.pieces[ROOK] | board.pieces[QUEEN])
-		&& (!several(board.colours[WHITE]) || !several(board.colours[BLACK]))
-		&& (    !several(board.pieces[KNIGHT] | board.pieces[BISHOP])
-				|| (!board.pieces[BISHOP] && popcount(board.pieces[KNIGHT]) <= 2));
-}
+	// Look for a single reversible move which returns to a position from
+	// earlier in the search. The difference between the current key and an
+	// earlier one must then be the key of that move, found in the Cuckoo
+	// tables, and the squares between its origin and destination must be
+	// empty. Cycles through the root would need a third repetition to be
+	// a draw, and null moves break the chain of keys, so we stop at either
 
-uint64_t perft(Board& board, int depth) {
+	const int end = MIN(MIN(board.halfMoveCounter, board.numMoves), MIN(pliesFromNull, height - 1));
+	const uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
 
-	Undo undo;
-	int size = 0;
-	uint64_t found = 0ull;
-	uint16_t moves[MAX_MOVES];
+	for (int i = 3; i <= end; i += 2) {
 
-	if (depth == 0)
-		return 1ull;
+		uint64_t moveKey = board.hash ^ keys[board.numMoves - i];
+		int slot = cuckooH1(moveKey);
 
-	genAllNoisyMoves(board, moves, size);
-	genAllQuietMoves(board, moves, size);
+		if (CuckooKeys[slot] != moveKey && CuckooKeys[slot = cuckooH2(moveKey)] != moveKey)
+			continue;
 
-	// Recurse on all valid moves
-	for(size -= 1; size >= 0; --size) {
-		applyMove(board, moves[size], undo);
-		if (moveWasLegal(board)) found += perft(board, depth-1);
-		revertMove(board, moves[size], undo);
+		uint16_t move = CuckooMoves[slot];
+		if (!(bitsBetweenMasks(MoveFrom(move), MoveTo(move)) & occupied))
+			return 1;
 	}
 
-	return found;
+	return 0;
+}
+
+int boardDrawnByInsufficientMaterial(Board& board) {
+
+	// Check for KvK, KvN, KvB, and KvNN.
+
+	return !(board.pieces[PAWN] | board.pieces[ROOK] | board.pieces[QUEEN])
+		&& (!several(board.colours[WHITE]) || !several(board.colours[BLACK]))
+		&& (    !several(board.pieces[KNIGHT] | board.pieces[BISHOP])
+				|| (!board.pieces[BISHOP] && popcount(board.pieces[KNIGHT]) <= 2));
 }
 
 void runBenchmark(int argc, char** argv) {
@@ -360,13 +523,18 @@ void runBenchmark(int argc, char** argv) {
 	Thread *threads;
 
 	double start;
-	uint64_t nodes = 0ull;
+	uint64_t nodes = 0ull, evalProbes = 0ull, evalHits = 0ull;
+	uint64_t misses[2];
 	uint16_t bestMove, ponderMove;
+	CacheCounters counters;
 
 	int depth     = argc > 2 ? atoi(argv[2]) : 13;
 	int nthreads  = argc > 3 ? atoi(argv[3]) : 1;
 	int megabytes = argc > 4 ? atoi(argv[4]) : 16;
 
+	// An optional seed for the Zobrist keys, see zobristtest
+	if (argc > 5) initZobrist(strtoull(argv[5], nullptr, 0));
+
 	initTT(megabytes);
 	threads = createThreadPool(nthreads);
 
@@ -375,24 +543,499 @@ void runBenchmark(int argc, char** argv) {
 	limits.limitedByTime  = 0;
 	limits.limitedByDepth = 1;
 	limits.limitedBySelf  = 0;
+	limits.limitedByNodes = 0;
 	limits.timeLimit      = 0;
 	limits.depthLimit     = depth;
 	limits.multiPV        = 1;
+	limits.silent         = 0;
 
 	start = getRealTime();
+	counters.start();
 
 	for (int i = 0; Benchmarks[i].size(); ++i) {
 		cout << "\nPosition #" << i + 1 << ": " << Benchmarks[i] << "\n";
 		boardFromFEN(board, Benchmarks[i], 0);
 		limits.start = getRealTime();
-		getBestMove(threads, board, limits, bestMove, ponderMove);
+		updateTT(); // Table has an age component
+		getBestMove(threads, board, nullptr, limits, bestMove, ponderMove);
 		nodes += nodesSearchedThreadPool(threads);
+		for (int j = 0; j < nthreads; ++j)
+			evalProbes += threads[j].evalProbes, evalHits += threads[j].evalHits;
 		clearTT(); // Reset TT for new search
 	}
 
+	counters.stop(misses);
+
+	cout << "\nEval Cache : " << evalHits << " hits / " << evalProbes << " probes ("
+		 << (evalProbes ? 100.0 * evalHits / evalProbes : 0.0) << "%)\n";
+
 	cout << "Time  : " << int(getRealTime() - start) << "ms\n";
 	cout << "Nodes : " << nodes << "\n";
 	cout << "NPS   : " << int(nodes / ((getRealTime() - start) / 1000.0)) << "\n";
 
-	free(threads);
-}
\ No newline at end of file
+	// Counters follow the calling thread, which runs the main search thread
+	if (counters.available())
+		printf("Cache : %.2f L1D misses, %.3f LLC misses per node\n",
+			double(misses[0]) / nodes, double(misses[1]) / nodes);
+	else
+		printf("Cache : unavailable (perf_event_open failed)\n");
+
+#ifdef PICKER_STATS
+	fflush(stdout);
+	printPickerStats(threads);
+#endif
+
+	deleteThreadPool(threads);
+}
+
+void runEvalBenchmark(int argc, char **argv) {
+
+	using namespace std::chrono;
+
+	Board board;
+	vector<string> fens;
+	string line;
+	uint64_t ns[EVAL_COMPONENT_NB] = {0};
+	uint64_t total = 0ull, evals = 0ull;
+	int checksum = 0;
+
+	// Usage: evalbench [fenfile] [passes]. Without a file we use the bench positions
+	if (argc > 2) {
+		ifstream file(argv[2]);
+		while (getline(file, line))
+			if (line.size() > 1) fens.push_back(line);
+	}
+	else for (int i = 0; Benchmarks[i].size(); ++i)
+		fens.push_back(Benchmarks[i]);
+
+	int passes = argc > 3 ? atoi(argv[3]) : argc > 2 ? 1 : 1000;
+
+	if (fens.empty()) {
+		cout << "No positions found\n";
+		return;
+	}
+
+	// The Pawn King Table is never read from, so every term is timed in full.
+	// The Material Table is read from, since in the search it nearly always hits
+	PKTable *pktable = new PKTable(true);
+	MaterialTable *mtable = new MaterialTable;
+	clearMaterialTable(*mtable);
+
+	// Estimate the cost of reading the clock, since every component pays for one
+	steady_clock::time_point start = steady_clock::now(), now = start;
+	for (int i = 0; i < 1 << 20; ++i) now = steady_clock::now();
+	double overhead = duration_cast<nanoseconds>(now - start).count() / double(1 << 20);
+
+	for (int pass = 0; pass < passes; ++pass) {
+		for (string& fen : fens) {
+			boardFromFEN(board, fen, 0);
+
+			start = steady_clock::now();
+			checksum += evaluateBoard(board, *pktable, *mtable);
+			total += duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+			checksum += timeEvaluation(board, *pktable, *mtable, ns);
+			evals++;
+		}
+	}
+
+	double sum = 0.0, adjusted[EVAL_COMPONENT_NB];
+	for (int i = 0; i < EVAL_COMPONENT_NB; ++i)
+		sum += adjusted[i] = MAX(0.0, ns[i] - overhead * evals);
+
+	cout << fixed << setprecision(1);
+	cout << "\n    Component |  ns/eval | share\n";
+	cout << " -------------+----------+--------\n";
+	for (int i = 0; i < EVAL_COMPONENT_NB; ++i)
+		cout << setw(13) << EvalComponentNames[i] << " | " << setw(8) << adjusted[i] / evals
+			 << " | " << setw(5) << 100.0 * adjusted[i] / sum << "%\n";
+	cout << " -------------+----------+--------\n";
+	cout << setw(13) << "Sum" << " | " << setw(8) << sum / evals << " |\n\n";
+
+	cout << "Positions     : " << fens.size() << " x " << passes << " passes\n";
+	cout << "evaluateBoard : " << double(total) / evals << " ns/eval (untimed)\n";
+	cout << "Clock Read    : " << overhead << " ns (subtracted per component)\n";
+	cout << "Checksum      : " << checksum << "\n";
+	cout.unsetf(ios::floatfield);
+
+	delete pktable;
+	delete mtable;
+}
+
+void runAttackBenchmark(int argc, char **argv) {
+
+	using namespace std::chrono;
+
+	Board board;
+	CacheCounters counters;
+	vector<uint64_t> occupancies;
+	set<uintptr_t> lines;
+	uint64_t checksum = 0ull, misses[3][2];
+	double seconds[3];
+
+	// Usage: attackbench [passes]. We use the occupancy of each bench position,
+	// so that the lookups are spread over the table in a realistic manner
+	int passes = argc > 2 ? atoi(argv[2]) : 20000;
+
+	for (int i = 0; Benchmarks[i].size(); ++i) {
+		boardFromFEN(board, Benchmarks[i], 0);
+		occupancies.push_back(board.colours[WHITE] | board.colours[BLACK]);
+	}
+
+	// Count the distinct cache lines of the attack table which the positions
+	// touch. Unlike the hardware counters, this is exact and reproducible
+	for (uint64_t occupied : occupancies)
+		for (int sq = 0; sq < SQUARE_NB; ++sq)
+			for (int piece : { BISHOP, ROOK })
+				lines.insert(uintptr_t(sliderTableEntry(piece, sq, occupied)) / 64);
+
+	for (int type = 0; type < 3; ++type) {
+
+		counters.start();
+		steady_clock::time_point start = steady_clock::now();
+
+		for (int pass = 0; pass < passes; ++pass)
+			for (uint64_t occupied : occupancies)
+				for (int sq = 0; sq < SQUARE_NB; ++sq)
+					checksum += type == 0 ? bishopAttacks(sq, occupied)
+							  : type == 1 ? rookAttacks(sq, occupied)
+										  : queenAttacks(sq, occupied);
+
+		seconds[type] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1e9;
+		counters.stop(misses[type]);
+	}
+
+	double lookups = double(passes) * occupancies.size() * SQUARE_NB;
+
+	#ifdef USE_PEXT
+		printf("\nIndexing : PEXT (compressed 16-bit entries)\n");
+	#else
+		printf("\nIndexing : Magic multiply (64-bit entries)\n");
+	#endif
+
+	printf("Tables   : %.1f KB (Magic is %d bytes)\n", sliderTableBytes() / 1024.0, int(sizeof(Magic)));
+	printf("Touched  : %d cache lines (%.1f KB) over %d positions\n",
+		int(lines.size()), lines.size() * 64 / 1024.0, int(occupancies.size()));
+	printf("Lookups  : %.0f per piece type\n", lookups);
+
+	const char *names[3] = { "Bishop", "Rook", "Queen" };
+	for (int type = 0; type < 3; ++type) {
+		printf("%-8s : %8.1f M/s", names[type], lookups / seconds[type] / 1e6);
+		if (counters.available())
+			printf("  L1D misses %6.2f  LLC misses %6.3f per 1000",
+				1000.0 * misses[type][0] / lookups, 1000.0 * misses[type][1] / lookups);
+		printf("\n");
+	}
+
+	if (!counters.available())
+		printf("Counters : unavailable (perf_event_open failed)\n");
+
+	printf("Checksum : %016" PRIx64 "\n", checksum);
+}
+
+void runFENBenchmark(int argc, char **argv) {
+
+	using namespace std::chrono;
+
+	vector<string> fens;
+	vector<Board> boards;
+	vector<vector<string>> moveStrs;
+	string line;
+	uint64_t checksum = 0ull, decoded = 0ull, total = 0ull;
+	char str[6];
+
+	// Usage: fenbench [fenfile] [passes]. Without a file we use the bench positions
+	if (argc > 2) {
+		ifstream file(argv[2]);
+		while (getline(file, line))
+			if (line.size() > 1) fens.push_back(line);
+	}
+	else for (int i = 0; Benchmarks[i].size(); ++i)
+		fens.push_back(Benchmarks[i]);
+
+	int passes = argc > 3 ? atoi(argv[3]) : MAX(1, 2000000 / MAX(1, int(fens.size())));
+
+	if (fens.empty()) {
+		cout << "No positions found\n";
+		return;
+	}
+
+	// Parse every FEN, passes times over
+	steady_clock::time_point start = steady_clock::now();
+	for (int pass = 0; pass < passes; ++pass) {
+		for (string& fen : fens) {
+			Board board;
+			boardFromFEN(board, fen, 0);
+			checksum += board.hash;
+		}
+	}
+	double parse = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1e9;
+
+	// Set aside each position, along with its legal moves in UCI notation
+	for (string& fen : fens) {
+
+		int size = 0;
+		uint16_t moves[MAX_MOVES];
+
+		boards.emplace_back();
+		boardFromFEN(boards.back(), fen, 0);
+		genAllLegalMoves(boards.back(), moves, size);
+
+		moveStrs.emplace_back();
+		for (int i = 0; i < size; ++i) {
+			moveToString(moves[i], str, boards.back().chess960);
+			moveStrs.back().push_back(str);
+		}
+	}
+
+	// Decode the moves by searching the legal moves for a match, as was once
+	// done by uciPosition(), and then again by reading the squares directly
+	double seconds[2];
+	for (int method = 0; method < 2; ++method) {
+
+		start = steady_clock::now();
+		for (int pass = 0; pass < passes; ++pass) {
+			for (size_t i = 0; i < boards.size(); ++i) {
+				for (string& moveStr : moveStrs[i]) {
+
+					uint16_t move = NONE_MOVE;
+
+					if (method == 1)
+						move = stringToMove(boards[i], moveStr.c_str());
+
+					else {
+						int size = 0;
+						uint16_t moves[MAX_MOVES];
+						genAllLegalMoves(boards[i], moves, size);
+						for (int j = 0; j < size && move == NONE_MOVE; ++j)
+							if (moveToString(moves[j], str, boards[i].chess960), moveStr == str)
+								move = moves[j];
+					}
+
+					checksum += move;
+					decoded  += method == 1 && move != NONE_MOVE;
+					total    += method == 1;
+				}
+			}
+		}
+		seconds[method] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1e9;
+	}
+
+	double positions = double(passes) * fens.size(), moves = total;
+
+	printf("\nPositions : %d x %d passes\n", int(fens.size()), passes);
+	printf("FEN Parse : %10.0f positions/sec (%.1f ns each)\n", positions / parse, 1e9 * parse / positions);
+	printf("Move Scan : %10.0f moves/sec (%.1f ns each)\n", moves / seconds[0], 1e9 * seconds[0] / moves);
+	printf("Move Read : %10.0f moves/sec (%.1f ns each)\n", moves / seconds[1], 1e9 * seconds[1] / moves);
+	printf("Decoded   : %" PRIu64 " of %" PRIu64 " legal moves\n", decoded, total);
+	printf("Checksum  : %016" PRIx64 "\n", checksum);
+}
+
+static uint64_t positionSignature(Board& board) {
+
+	// An exact fingerprint of the position which does not use the Zobrist
+	// keys, so that transpositions can be told apart from key collisions
+	uint64_t words[SQUARE_NB / 8], signature = board.castleRooks;
+
+	memcpy(words, board.squares, sizeof(words));
+	signature ^= (uint64_t)board.turn << 32 | (uint32_t)board.epSquare;
+
+	for (uint64_t word : words) {
+		signature = (signature ^ word) * 0xFF51AFD7ED558CCDull;
+		signature ^= signature >> 33;
+	}
+
+	return signature;
+}
+
+static void collectPositions(Board& board, int depth, vector<pair<uint64_t, uint64_t>>& positions) {
+
+	Undo undo;
+	int size = 0;
+	uint16_t moves[MAX_MOVES];
+
+	positions.push_back({ board.hash, positionSignature(board) });
+	if (depth == 0) return;
+
+	genAllLegalMoves(board, moves, size);
+	for (int i = 0; i < size; ++i) {
+		applyMove(board, moves[i], undo);
+		collectPositions(board, depth - 1, positions);
+		revertMove(board, moves[i], undo);
+	}
+}
+
+void runZobristTest(int argc, char **argv) {
+
+	Board board;
+	vector<string> fens;
+	vector<pair<uint64_t, uint64_t>> positions;
+	vector<uint64_t> keys;
+	string line;
+
+	// Usage: zobristtest [seed] [depth] [fenfile]. Every position within the
+	// given depth of each starting position is collected, and the distinct
+	// ones are spread over Transposition Tables of several sizes
+	uint64_t seed = argc > 2 ? strtoull(argv[2], nullptr, 0) : 0ull;
+	int depth     = argc > 3 ? atoi(argv[3]) : 3;
+
+	if (argc > 4) {
+		ifstream file(argv[4]);
+		while (getline(file, line))
+			if (line.size() > 1) fens.push_back(line);
+	}
+	else for (int i = 0; Benchmarks[i].size(); ++i)
+		fens.push_back(Benchmarks[i]);
+
+	initZobrist(seed);
+
+	// Every reversible move should have found a slot in the Cuckoo tables
+	int dropped = 3668 - int(count_if(CuckooMoves, CuckooMoves + CUCKOO_SIZE,
+		[](uint16_t move) { return move != NONE_MOVE; }));
+
+	for (string& fen : fens) {
+		boardFromFEN(board, fen, 0);
+		collectPositions(board, depth, positions);
+	}
+
+	uint64_t visited = positions.size();
+
+	// Keep one entry per distinct position, and then look for any two
+	// distinct positions which were given the same full 64-bit key
+	sort(positions.begin(), positions.end(), [](const pair<uint64_t, uint64_t>& a,
+		const pair<uint64_t, uint64_t>& b) { return a.second < b.second; });
+	positions.erase(unique(positions.begin(), positions.end()), positions.end());
+
+	for (auto& position : positions)
+		keys.push_back(position.first);
+	sort(keys.begin(), keys.end());
+
+	uint64_t collisions = 0ull;
+	for (size_t i = 1; i < keys.size(); ++i)
+		collisions += keys[i] == keys[i-1];
+
+	double N = keys.size(), pairs = N * (N - 1) / 2;
+
+	printf("\nKeys      : seed %" PRIu64 " (%s)\n", seed, seed ? "splitmix64" : "xorshift64*, default");
+	printf("Positions : %.0f distinct of %" PRIu64 " visited (depth %d, %d fens)\n", N, visited, depth, int(fens.size()));
+	printf("Cuckoo    : %d keys dropped\n", dropped);
+	printf("Full keys : %" PRIu64 " collisions between distinct positions\n\n", collisions);
+
+	printf("      Hash |  Buckets | Max Load | Chi2 z-score |    Aliased Pairs (obs / exp) |  hash16 Matches (obs / exp)\n");
+	printf(" ----------+----------+----------+--------------+------------------------------+----------------------------\n");
+
+	// Each key is placed in a bucket by its low bits, as in getTTEntry(), and
+	// then its hash16 is appended, so that sorting groups the keys first by
+	// bucket and then by hash16. Aliased pairs share a bucket, and those with
+	// the same hash16 as well would be mistaken for one another in the table
+	for (uint64_t megabytes : { 1ull, 16ull, 256ull, 4096ull, 65536ull }) {
+
+		// Sized just as in initTT(), with 32-byte buckets
+		int keySize = 16;
+		for (; 1ull << (keySize + 5) <= megabytes << 20; ++keySize);
+		keySize = keySize - 1;
+
+		uint64_t buckets = 1ull << keySize, maxLoad = 0ull;
+		double squares = 0.0, aliased = 0.0, matches = 0.0;
+		vector<uint64_t> slots;
+
+		for (uint64_t key : keys)
+			slots.push_back((key & (buckets - 1)) << 16 | key >> 48);
+		sort(slots.begin(), slots.end());
+
+		for (size_t i = 0, j; i < slots.size(); i = j) {
+
+			for (j = i; j < slots.size() && slots[j] >> 16 == slots[i] >> 16; ++j);
+			uint64_t load = j - i;
+			maxLoad = MAX(maxLoad, load);
+			squares += double(load) * load;
+			aliased += double(load) * (load - 1) / 2;
+
+			for (size_t k = i, l; k < j; k = l) {
+				for (l = k; l < j && slots[l] == slots[k]; ++l);
+				matches += double(l - k) * (l - k - 1) / 2;
+			}
+		}
+
+		// Pearson's statistic over the buckets has a mean of (buckets - 1) and a
+		// variance of twice that for uniform keys, which gives us a z-score
+		double chi2 = squares * buckets / N - N;
+		double zscore = (chi2 - (buckets - 1)) / sqrt(2.0 * (buckets - 1));
+
+		printf(" %7" PRIu64 "MB |     2^%-2d | %8" PRIu64 " | %12.2f | %12.0f / %13.1f | %11.0f / %12.3f\n",
+			megabytes, keySize, maxLoad, zscore, aliased, pairs / buckets, matches, pairs / buckets / 65536);
+	}
+
+	printf("\n");
+}
+
+void runStartupBenchmark(int argc, char **argv) {
+
+	using namespace std::chrono;
+
+	Board board;
+	Thread *threads;
+	double total = 0.0;
+
+	// Usage: startupbench [launches]. First we repeat each step which main()
+	// performs before reading any input, and then we time complete launches
+	// of this binary, which exit at once when given an empty stdin
+	int launches = argc > 2 ? atoi(argv[2]) : 50;
+
+	steady_clock::time_point last = steady_clock::now();
+
+	auto lap = [&](const char *name) {
+		double micros = duration_cast<nanoseconds>(steady_clock::now() - last).count() / 1e3;
+		printf("%-8s : %8.1f us\n", name, micros);
+		total += micros, last = steady_clock::now();
+	};
+
+	printf("\n");
+	initEval();                           lap("Eval");
+	initSearch();                         lap("Search");
+	initZobrist(0);                       lap("Zobrist");
+	initEndgames();                       lap("Endgame");
+	initTT(16);                           lap("TT");
+	threads = createThreadPool(1);        lap("Threads");
+	boardFromFEN(board, Benchmarks[0], 0); lap("Position");
+	printf("Total    : %8.1f us\n", total);
+
+	deleteThreadPool(threads);
+
+#ifdef __linux__
+
+	vector<double> times;
+	posix_spawn_file_actions_t actions;
+	char *args[] = { argv[0], nullptr };
+
+	// The child reads from, and writes to, /dev/null
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_addopen(&actions, STDIN_FILENO,  "/dev/null", O_RDONLY, 0);
+	posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+
+	for (int i = 0; i < launches; ++i) {
+
+		pid_t pid; int status;
+		steady_clock::time_point start = steady_clock::now();
+
+		if (posix_spawn(&pid, argv[0], &actions, nullptr, args, environ)) {
+			printf("Launches : unavailable (posix_spawn failed)\n");
+			break;
+		}
+
+		waitpid(pid, &status, 0);
+		times.push_back(duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1e6);
+	}
+
+	posix_spawn_file_actions_destroy(&actions);
+
+	if (!times.empty()) {
+		sort(times.begin(), times.end());
+		printf("Launches : %d, min %.3f ms, median %.3f ms, max %.3f ms\n",
+			int(times.size()), times[0], times[times.size() / 2], times.back());
+	}
+
+#else
+	(void)launches; // Process launches are only timed on Linux
+#endif
+}
@@ -24,34 +24,80 @@ using namespace std;
 
 extern const char *PieceLabel[COLOUR_NB];
 
-class Board {
-public:
+// Attack counts are stored bit-sliced, one bitboard per binary digit. No
+// square can be attacked by more than the 16 pieces of one colour
+
+enum { ATTACK_PLANES = 5 };
+
+// Everything a move may change, kept together at the front of the Board
+// with the bitboards first. Copy-make saves and restores just this part
+
+struct BoardState {
+	uint64_t pieces[8], colours[3];
+	uint64_t hash, pkhash, materialKey, kingAttackers, pinned, castleRooks;
+#ifdef USE_ATTACK_MAPS
+	uint64_t attackMaps[COLOUR_NB][ATTACK_PLANES];
+#endif
 	uint8_t squares[SQUARE_NB];
-	uint64_t pieces[8], colours[3], history[512];
-	uint64_t hash, pkhash, kingAttackers;
-	uint64_t castleRooks, castleMasks[SQUARE_NB];
 	int turn, epSquare, halfMoveCounter, fullMoveCounter;
-	int psqtmat, numMoves, chess960;
+	int psqtmat, numMoves;
+};
+
+class Board : public BoardState {
+public:
+	int chess960;
 	
 	void operator()(){
 	memset(this, 0, sizeof(*this));
 	memset(&squares, EMPTY, sizeof(squares));return;}
 };
 
+#ifdef USE_COPY_MAKE
+
+struct Undo : BoardState {
+	int capturePiece;
+};
+
+#else
+
 struct Undo {
-	uint64_t hash, pkhash, kingAttackers, castleRooks;
+	uint64_t hash, pkhash, materialKey, kingAttackers, pinned, castleRooks;
 	int epSquare, halfMoveCounter, psqtmat, capturePiece;
+#ifdef USE_ATTACK_MAPS
+	uint64_t attackMaps[COLOUR_NB][ATTACK_PLANES];
+#endif
+};
+
+#endif
+
+// Keys of the positions leading up to a Board, indexed by numMoves and used
+// to detect repetitions. Kept apart from the Board, which is copied often
+
+struct RepetitionStack {
+	uint64_t *keys;
+	int capacity;
 };
 
+void reserveRepetitionStack(RepetitionStack& stack, int size);
+void deleteRepetitionStack(RepetitionStack& stack);
+
 void squareToString(int sq, char *str);
-void boardFromFEN(Board& board,const string& fen, int chess960);
+void boardFromFEN(Board& board, const string& fen, int chess960);
+void boardFromFEN(Board& board, const char *fen, int chess960);
 void boardToFEN(Board& board, string& fen);
+void packBoard(Board& board, PackedBoard& packed);
+void unpackBoard(Board& board, const PackedBoard& packed, int chess960);
 void printBoard(Board& board);
 int boardHasNonPawnMaterial(Board& board, int turn);
-int boardIsDrawn(Board& board, int height);
+int boardIsDrawn(Board& board, const uint64_t *keys, int height);
 int boardDrawnByFiftyMoveRule(Board& board);
-int boardDrawnByRepetition(Board& board, int height);
+int boardDrawnByRepetition(Board& board, const uint64_t *keys, int height);
+int boardHasUpcomingRepetition(Board& board, const uint64_t *keys, int height, int pliesFromNull);
 int boardDrawnByInsufficientMaterial(Board& board);
 
-uint64_t perft(Board& board, int depth);
 void runBenchmark(int argc, char **argv);
+void runEvalBenchmark(int argc, char **argv);
+void runAttackBenchmark(int argc, char **argv);
+void runFENBenchmark(int argc, char **argv);
+void runZobristTest(int argc, char **argv);
+void runStartupBenchmark(int argc, char **argv);
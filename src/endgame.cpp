@@ -0,0 +1,351 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+
+#include "attacks.h"
+#include "bitboards.h"
+#include "board.h"
+#include "endgame.h"
+#include "evaluate.h"
+#include "kpk.h"
+#include "masks.h"
+#include "types.h"
+#include "zobrist.h"
+
+namespace {
+
+enum { KPK_INVALID = 0, KPK_UNKNOWN = 1, KPK_DRAW = 2, KPK_WIN = 4 };
+
+enum { KPK_SIZE = 2 * SQUARE_NB * SQUARE_NB * 24 };
+
+const int SCALE_KR_VS_MINOR = 24;
+
+const int EndgameValues[PIECE_NB] = { 100, 325, 325, 500, 1000, 0 };
+
+Endgame EndgameTable[ENDGAME_TABLE_SIZE];
+
+static_assert(sizeof(KPKBitbase) * 8 == KPK_SIZE, "KPK bitbase size mismatch");
+
+// Edge and corner distances, used to drive the weak King during a mate
+const int PushToEdges[SQUARE_NB] = {
+    100, 90, 80, 70, 70, 80, 90, 100,
+     90, 70, 60, 50, 50, 60, 70,  90,
+     80, 60, 40, 30, 30, 40, 60,  80,
+     70, 50, 30, 20, 20, 30, 50,  70,
+     70, 50, 30, 20, 20, 30, 50,  70,
+     80, 60, 40, 30, 30, 40, 60,  80,
+     90, 70, 60, 50, 50, 60, 70,  90,
+    100, 90, 80, 70, 70, 80, 90, 100,
+};
+
+const int PushClose[FILE_NB] = { 0, 0, 100, 80, 60, 40, 20, 10 };
+
+int kpkIndex(int stm, int wking, int bking, int pawn) {
+
+    // The Pawn is on files A through D, and ranks 2 through 7
+    const int pawnIndex = fileOf(pawn) + 4 * (rankOf(pawn) - 1);
+    return wking | (bking << 6) | (stm << 12) | (pawnIndex << 13);
+}
+
+#ifndef NDEBUG
+
+int kpkInitial(int stm, int wking, int bking, int pawn) {
+
+    const int push = pawn + 8;
+
+    // Kings touching, or a King standing on the Pawn
+    if (   distanceBetween(wking, bking) <= 1
+        || wking == pawn || bking == pawn)
+        return KPK_INVALID;
+
+    // The Black King may not be left in check by the Pawn
+    if (stm == WHITE && testBit(pawnAttacks(WHITE, pawn), bking))
+        return KPK_INVALID;
+
+    // The Pawn promotes immediately and can't be captured
+    if (   stm == WHITE && rankOf(pawn) == 6
+        && wking != push && bking != push
+        && (distanceBetween(bking, push) > 1 || distanceBetween(wking, push) == 1))
+        return KPK_WIN;
+
+    if (stm == BLACK) {
+
+        const uint64_t unsafe = kingAttacks(wking) | pawnAttacks(WHITE, pawn);
+
+        // Stalemate, or the Black King captures an undefended Pawn
+        if (   (!(kingAttacks(bking) & ~unsafe) && !testBit(pawnAttacks(WHITE, pawn), bking))
+            || (testBit(kingAttacks(bking), pawn) && !testBit(kingAttacks(wking), pawn)))
+            return KPK_DRAW;
+    }
+
+    return KPK_UNKNOWN;
+}
+
+int kpkClassify(uint8_t *db, int stm, int wking, int bking, int pawn) {
+
+    int result = KPK_INVALID;
+    uint64_t moves;
+
+    // White can only move the King or push the Pawn. Promotions were
+    // resolved when setting up the initial table, so we ignore them
+    if (stm == WHITE) {
+
+        moves = kingAttacks(wking);
+        while (moves)
+            result |= db[kpkIndex(BLACK, poplsb(moves), bking, pawn)];
+
+        if (rankOf(pawn) < 6 && pawn + 8 != wking && pawn + 8 != bking) {
+            result |= db[kpkIndex(BLACK, wking, bking, pawn + 8)];
+            if (   rankOf(pawn) == 1
+                && pawn + 16 != wking && pawn + 16 != bking)
+                result |= db[kpkIndex(BLACK, wking, bking, pawn + 16)];
+        }
+
+        return (result & KPK_WIN) ? KPK_WIN : (result & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_DRAW;
+    }
+
+    moves = kingAttacks(bking);
+    while (moves)
+        result |= db[kpkIndex(WHITE, wking, poplsb(moves), pawn)];
+
+    return (result & KPK_DRAW) ? KPK_DRAW : (result & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_WIN;
+}
+
+void verifyKPK() {
+
+    uint8_t *db = (uint8_t*)calloc(KPK_SIZE, 1);
+    int changed = 1;
+
+    // Classify everything that can be known without looking ahead
+    for (int idx = 0; idx < KPK_SIZE; ++idx) {
+        const int pawnIndex = idx >> 13;
+        const int pawn = square(1 + pawnIndex / 4, pawnIndex % 4);
+        db[idx] = kpkInitial((idx >> 12) & 1, idx & 63, (idx >> 6) & 63, pawn);
+    }
+
+    // Propagate the results backwards until nothing changes
+    while (changed) {
+        changed = 0;
+        for (int idx = 0; idx < KPK_SIZE; ++idx) {
+            if (db[idx] != KPK_UNKNOWN) continue;
+            const int pawnIndex = idx >> 13;
+            const int pawn = square(1 + pawnIndex / 4, pawnIndex % 4);
+            db[idx] = kpkClassify(db, (idx >> 12) & 1, idx & 63, (idx >> 6) & 63, pawn);
+            changed |= db[idx] != KPK_UNKNOWN;
+        }
+    }
+
+    // Anything left unknown after the propagation is a draw
+    for (int idx = 0; idx < KPK_SIZE; ++idx)
+        assert((db[idx] == KPK_WIN) == ((KPKBitbase[idx / 64] >> (idx % 64)) & 1));
+
+    free(db);
+}
+
+#endif
+
+uint64_t makeMaterialKey(const int counts[COLOUR_NB][PIECE_NB]) {
+
+    uint64_t key = 0ull;
+
+    for (int colour = WHITE; colour <= BLACK; ++colour)
+        for (int piece = PAWN; piece < KING; ++piece)
+            key += counts[colour][piece] * MaterialKeys[makePiece(piece, colour)];
+
+    return key;
+}
+
+void addEndgame(const int counts[COLOUR_NB][PIECE_NB], EndgameFn evaluate, EndgameFn scale, int strong) {
+
+    const uint64_t key = makeMaterialKey(counts);
+    int idx = (key * 0x9E3779B97F4A7C15ull) >> (64 - ENDGAME_TABLE_KEY_SIZE);
+
+    // Linear probing. The table is kept well below a quarter full
+    while (EndgameTable[idx].key)
+        idx = (idx + 1) % ENDGAME_TABLE_SIZE;
+
+    EndgameTable[idx].key      = key;
+    EndgameTable[idx].evaluate = evaluate;
+    EndgameTable[idx].scale    = scale;
+    EndgameTable[idx].strong   = strong;
+}
+
+int relativeKPKSquare(int strong, int pawnFile, int sq) {
+
+    // Normalise so that White is the strong side and the Pawn is on files A-D
+    if (strong == BLACK) sq ^= 56;
+    if (pawnFile >= 4)   sq ^= 7;
+    return sq;
+}
+
+}
+
+void initEndgames() {
+
+    int counts[COLOUR_NB][PIECE_NB] = {{0}};
+
+#ifndef NDEBUG
+    verifyKPK();
+#endif
+
+    // Every distribution of the original material against a bare King
+    for (int strong = WHITE; strong <= BLACK; ++strong) {
+        for (int p = 0; p <= 8; ++p) {
+        for (int n = 0; n <= 2; ++n) {
+        for (int b = 0; b <= 2; ++b) {
+        for (int r = 0; r <= 2; ++r) {
+        for (int q = 0; q <= 1; ++q) {
+
+            int *c = counts[strong];
+            c[PAWN] = p, c[KNIGHT] = n, c[BISHOP] = b, c[ROOK] = r, c[QUEEN] = q;
+
+            if (n + b + r + q == 0 && p == 1)
+                addEndgame(counts, evaluateKPK, nullptr, strong);
+
+            else if (n + b + r + q == 0 && p >= 2)
+                addEndgame(counts, nullptr, scaleKPsK, strong);
+
+            else if (n + r + q == 0 && b == 1 && p >= 1)
+                addEndgame(counts, nullptr, scaleKBPsK, strong);
+
+            else if (q || r || (b && n) || b == 2)
+                addEndgame(counts, evaluateKXK, nullptr, strong);
+        }}}}}
+
+        counts[strong][PAWN] = counts[strong][KNIGHT] = counts[strong][BISHOP] = 0;
+        counts[strong][ROOK] = counts[strong][QUEEN] = 0;
+    }
+
+    // A lone Rook against a lone minor piece is usually drawn
+    for (int strong = WHITE; strong <= BLACK; ++strong) {
+        for (int minor = KNIGHT; minor <= BISHOP; ++minor) {
+            counts[strong][ROOK] = counts[!strong][minor] = 1;
+            addEndgame(counts, nullptr, scaleKRKMinor, strong);
+            counts[strong][ROOK] = counts[!strong][minor] = 0;
+        }
+    }
+}
+
+const Endgame* probeEndgame(uint64_t materialKey) {
+
+    int idx = (materialKey * 0x9E3779B97F4A7C15ull) >> (64 - ENDGAME_TABLE_KEY_SIZE);
+
+    for (; EndgameTable[idx].key; idx = (idx + 1) % ENDGAME_TABLE_SIZE)
+        if (EndgameTable[idx].key == materialKey)
+            return &EndgameTable[idx];
+
+    return nullptr;
+}
+
+int probeKPK(int stm, int wking, int bking, int pawn) {
+
+    // Assumes White holds the Pawn, which must be on files A through D
+    const int idx = kpkIndex(stm, wking, bking, pawn);
+    return (KPKBitbase[idx / 64] >> (idx % 64)) & 1;
+}
+
+int evaluateKXK(Board& board, int strong) {
+
+    const uint64_t friendly = board.colours[strong];
+    const uint64_t bishops  = friendly & board.pieces[BISHOP];
+
+    const int strongKing = getlsb(friendly & board.pieces[KING]);
+    const int weakKing   = getlsb(board.colours[!strong] & board.pieces[KING]);
+
+    int eval = 0;
+
+    // Bishops alone can't mate if they share a colour
+    if (  !(friendly & (board.pieces[PAWN] | board.pieces[KNIGHT] | board.pieces[ROOK] | board.pieces[QUEEN]))
+        && (!(bishops & WHITE_SQUARES) || !(bishops & BLACK_SQUARES)))
+        return 0;
+
+    // Count material so that promotions and captures are still encouraged
+    for (int piece = PAWN; piece < KING; ++piece)
+        eval += EndgameValues[piece] * popcount(friendly & board.pieces[piece]);
+
+    // Drive the weak King to the edge, and bring our own King closer
+    eval += ENDGAME_KNOWN_WIN + PushToEdges[weakKing]
+          + PushClose[distanceBetween(strongKing, weakKing)];
+
+    // With only a Bishop and a Knight, mate is forced in the Bishop's corners
+    if (   onlyOne(bishops) && onlyOne(friendly & board.pieces[KNIGHT])
+        && !(friendly & (board.pieces[PAWN] | board.pieces[ROOK] | board.pieces[QUEEN]))) {
+        const int corner = testBit(WHITE_SQUARES, getlsb(bishops)) ? 7 : 0;
+        eval += 20 * (7 - MIN(distanceBetween(weakKing, corner),
+                              distanceBetween(weakKing, corner ^ 56)));
+    }
+
+    return strong == WHITE ? eval : -eval;
+}
+
+int evaluateKPK(Board& board, int strong) {
+
+    const int pawn  = getlsb(board.pieces[PAWN]);
+    const int file  = fileOf(pawn);
+    const int stm   = strong == WHITE ? board.turn : !board.turn;
+
+    const int wking = relativeKPKSquare(strong, file, getlsb(board.colours[ strong] & board.pieces[KING]));
+    const int bking = relativeKPKSquare(strong, file, getlsb(board.colours[!strong] & board.pieces[KING]));
+    const int psq   = relativeKPKSquare(strong, file, pawn);
+
+    if (!probeKPK(stm, wking, bking, psq))
+        return 0;
+
+    const int eval = ENDGAME_KNOWN_WIN + EndgameValues[PAWN] + 20 * rankOf(psq);
+    return strong == WHITE ? eval : -eval;
+}
+
+int scaleKPsK(Board& board, int strong) {
+
+    const uint64_t pawns = board.pieces[PAWN];
+    const int weakKing = getlsb(board.colours[!strong] & board.pieces[KING]);
+
+    // Rook Pawns on a single file can't win if the weak King holds the corner
+    if (!(pawns & ~FILE_A) || !(pawns & ~FILE_H)) {
+        const int queening = square(strong == WHITE ? 7 : 0, fileOf(getlsb(pawns)));
+        if (distanceBetween(weakKing, queening) <= 1)
+            return SCALE_DRAW;
+    }
+
+    return SCALE_NORMAL;
+}
+
+int scaleKBPsK(Board& board, int strong) {
+
+    const uint64_t pawns = board.pieces[PAWN];
+    const uint64_t bishops = board.pieces[BISHOP];
+    const int weakKing = getlsb(board.colours[!strong] & board.pieces[KING]);
+
+    // Rook Pawns with a Bishop which does not cover the queening square
+    if (!(pawns & ~FILE_A) || !(pawns & ~FILE_H)) {
+        const int queening = square(strong == WHITE ? 7 : 0, fileOf(getlsb(pawns)));
+        if (   !(squaresOfMatchingColour(queening) & bishops)
+            && distanceBetween(weakKing, queening) <= 1)
+            return SCALE_DRAW;
+    }
+
+    return SCALE_NORMAL;
+}
+
+int scaleKRKMinor(Board& board, int strong) {
+    (void)board; (void)strong;
+    return SCALE_KR_VS_MINOR;
+}
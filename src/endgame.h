@@ -0,0 +1,55 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "types.h"
+
+enum {
+    ENDGAME_TABLE_KEY_SIZE = 12,
+    ENDGAME_TABLE_SIZE     = 1 << ENDGAME_TABLE_KEY_SIZE,
+    ENDGAME_KNOWN_WIN      = 10000,
+};
+
+typedef int (*EndgameFn)(Board& board, int strong);
+
+// A specialised evaluation, or a specialised scale factor, for one material
+// signature. Evaluations are from White's point of view, and replace the
+// general evaluation entirely. Scale factors replace evaluateScaleFactor()
+struct Endgame {
+    uint64_t key;
+    EndgameFn evaluate;
+    EndgameFn scale;
+    int strong;
+};
+
+void initEndgames();
+const Endgame* probeEndgame(uint64_t materialKey);
+int probeKPK(int stm, int wking, int bking, int pawn);
+
+int evaluateKXK(Board& board, int strong);
+int evaluateKPK(Board& board, int strong);
+int scaleKPsK(Board& board, int strong);
+int scaleKBPsK(Board& board, int strong);
+int scaleKRKMinor(Board& board, int strong);
+
+inline int materialCount(uint64_t materialKey, int piece) {
+    return (materialKey >> (4 * (2 * pieceType(piece) + pieceColour(piece)))) & 15;
+}
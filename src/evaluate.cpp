@@ -16,20 +16,51 @@
 	along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 
 #include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
+#include "endgame.h"
 #include "evaluate.h"
 #include "masks.h"
+#include "texel.h"
 #include "transposition.h"
 #include "types.h"
 
 EvalTrace T, EmptyTrace;
 int PSQT[32][SQUARE_NB];
 
+const char *EvalComponentNames[EVAL_COMPONENT_NB] = {
+	"Init", "Pawns", "Knights", "Bishops", "Rooks", "Queens", "Kings",
+	"Passed", "Threats", "Closedness", "Complexity", "Scale Factor"
+};
+
+namespace {
+
+// The per-colour terms, in the order evaluatePieces() calls them. Only used
+// to print and time the evaluation, never by the search itself
+typedef int (*EvalTermFn)(EvalInfo& ei, Board& board);
+
+const EvalTermFn EvalTerms[][COLOUR_NB] = {
+	{   evaluatePawns<WHITE>,   evaluatePawns<BLACK> },
+	{ evaluateKnights<WHITE>, evaluateKnights<BLACK> },
+	{ evaluateBishops<WHITE>, evaluateBishops<BLACK> },
+	{   evaluateRooks<WHITE>,   evaluateRooks<BLACK> },
+	{  evaluateQueens<WHITE>,  evaluateQueens<BLACK> },
+	{   evaluateKings<WHITE>,   evaluateKings<BLACK> },
+	{  evaluatePassed<WHITE>,  evaluatePassed<BLACK> },
+	{ evaluateThreats<WHITE>, evaluateThreats<BLACK> },
+};
+
+// Never read from, so that every Pawn King term is computed from scratch
+PKTable NoPKTable(true);
+
+}
+
 #define S(mg, eg) (MakeScore((mg), (eg)))
 
 /* Material Value Evaluation Terms */
@@ -339,10 +370,18 @@ const int ComplexityAdjustment  = S(   0,-110);
 /* General Evaluation Terms */
 const int Tempo = 20;
 
-int evaluateBoard(Board& board, PKTable& pktable) {
+int evaluateBoard(Board& board, PKTable& pktable, MaterialTable& mtable) {
 
 	EvalInfo ei;
-	int phase, factor, eval, pkeval;
+	int factor, eval, pkeval;
+
+	// Known endgames may replace the general evaluation entirely
+	const MaterialEntry& material = getMaterialEntry(mtable, board.materialKey);
+	const Endgame *endgame = TRACE ? nullptr : material.endgame;
+	if (endgame && endgame->evaluate) {
+		eval = endgame->evaluate(board, endgame->strong);
+		return board.turn == WHITE ? eval : -eval;
+	}
 
 	// Setup and perform all evaluations
 	initEvalInfo(ei, board, pktable);
@@ -352,19 +391,8 @@ int evaluateBoard(Board& board, PKTable& pktable) {
 	eval  += evaluateClosedness(ei, board);
 	eval  += evaluateComplexity(ei, board, eval);
 
-	// Calculate the game phase based on remaining material (Fruit Method)
-	phase = 24 - 4 * popcount(board.pieces[QUEEN ])
-					- 2 * popcount(board.pieces[ROOK  ])
-					- 1 * popcount(board.pieces[KNIGHT]
-									|board.pieces[BISHOP]);
-	phase = (phase * 256 + 12) / 24;
-
-	// Scale evaluation based on remaining material
-	factor = evaluateScaleFactor(board, eval);
-
 	// Compute the interpolated and scaled evaluation
-	eval = (ScoreMG(eval) * (256 - phase)
-			+  ScoreEG(eval) * phase * factor / SCALE_NORMAL) / 256;
+	eval = interpolateEvaluation(board, material, eval, factor);
 
 	// Factor in the Tempo after interpolation and scaling, so that
 	// in the search we can assume that if a null move is made, then
@@ -374,45 +402,86 @@ int evaluateBoard(Board& board, PKTable& pktable) {
 	// Store a new Pawn King Entry if we did not have one
 	if ( !ei.pkentry ) {
 		PKEntry& pkentry = pktable.entries[board.pkhash >> PKT_HASH_SHIFT];	
-		pkentry.pkhash = board.pkhash;
-		pkentry.passed = ei.passedPawns;
-		pkentry.eval   = pkeval;
+		pkentry.pkhash             = board.pkhash;
+		pkentry.passed             = ei.passedPawns;
+		pkentry.pawnAttacks[WHITE] = ei.pawnAttacks[WHITE];
+		pkentry.pawnAttacks[BLACK] = ei.pawnAttacks[BLACK];
+		pkentry.rammedPawns[WHITE] = ei.rammedPawns[WHITE];
+		pkentry.rammedPawns[BLACK] = ei.rammedPawns[BLACK];
+		pkentry.eval               = pkeval;
+		pkentry.closedness         = ei.closedness;
 	}
 
 	// Return the evaluation relative to the side to move
 	return board.turn == WHITE ? eval : -eval;
 }
-inline int evaluateBoard(Board& board) {
-	PKTable k(1);
-	return evaluateBoard(board, k); }
+
+MaterialEntry& getMaterialEntry(MaterialTable& mtable, uint64_t materialKey) {
+
+	MaterialEntry& entry = mtable.entries[(materialKey * 0x9E3779B97F4A7C15ull) >> (64 - MT_KEY_SIZE)];
+
+	if (entry.materialKey != materialKey)
+		initMaterialEntry(entry, materialKey);
+
+	return entry;
+}
+
+void initMaterialEntry(MaterialEntry& entry, uint64_t materialKey) {
+
+	int counts[COLOUR_NB][PIECE_NB] = {{0}};
+
+	for (int colour = WHITE; colour <= BLACK; ++colour)
+		for (int piece = PAWN; piece < KING; ++piece)
+			counts[colour][piece] = materialCount(materialKey, makePiece(piece, colour));
+
+	auto total = [&](int piece) { return counts[WHITE][piece] + counts[BLACK][piece]; };
+
+	// Calculate the game phase based on remaining material (Fruit Method)
+	int phase = 24 - 4 * total(QUEEN) - 2 * total(ROOK) - 1 * (total(KNIGHT) + total(BISHOP));
+
+	// evaluateScaleFactor() only looks at a single Bishop for each side, or
+	// at a side whose only piece besides the King is a single minor piece
+	int scaling = counts[WHITE][BISHOP] == 1 && counts[BLACK][BISHOP] == 1;
+	for (int colour = WHITE; colour <= BLACK; ++colour)
+		scaling |=  counts[colour][KNIGHT] + counts[colour][BISHOP] == 1
+				&& !counts[colour][PAWN] && !counts[colour][ROOK] && !counts[colour][QUEEN];
+
+	entry.materialKey = materialKey;
+	entry.endgame     = probeEndgame(materialKey);
+	entry.phase       = (phase * 256 + 12) / 24;
+	entry.scaling     = scaling;
+}
 
 int evaluatePieces(EvalInfo& ei, Board& board) {
 
 	int eval;
 
-	eval  =   evaluatePawns(ei, board, WHITE)   - evaluatePawns(ei, board, BLACK);
-	eval += evaluateKnights(ei, board, WHITE) - evaluateKnights(ei, board, BLACK);
-	eval += evaluateBishops(ei, board, WHITE) - evaluateBishops(ei, board, BLACK);
-	eval +=   evaluateRooks(ei, board, WHITE)   - evaluateRooks(ei, board, BLACK);
-	eval +=  evaluateQueens(ei, board, WHITE)  - evaluateQueens(ei, board, BLACK);
-	eval +=   evaluateKings(ei, board, WHITE)   - evaluateKings(ei, board, BLACK);
-	eval +=  evaluatePassed(ei, board, WHITE)  - evaluatePassed(ei, board, BLACK);
-	eval += evaluateThreats(ei, board, WHITE) - evaluateThreats(ei, board, BLACK);
+	eval  =   evaluatePawns<WHITE>(ei, board)   - evaluatePawns<BLACK>(ei, board);
+	eval += evaluateKnights<WHITE>(ei, board) - evaluateKnights<BLACK>(ei, board);
+	eval += evaluateBishops<WHITE>(ei, board) - evaluateBishops<BLACK>(ei, board);
+	eval +=   evaluateRooks<WHITE>(ei, board)   - evaluateRooks<BLACK>(ei, board);
+	eval +=  evaluateQueens<WHITE>(ei, board)  - evaluateQueens<BLACK>(ei, board);
+	eval +=   evaluateKings<WHITE>(ei, board)   - evaluateKings<BLACK>(ei, board);
+	eval +=  evaluatePassed<WHITE>(ei, board)  - evaluatePassed<BLACK>(ei, board);
+	eval += evaluateThreats<WHITE>(ei, board) - evaluateThreats<BLACK>(ei, board);
 
 	return eval;
 }
 
-int evaluatePawns(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluatePawns(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
-	const int Forward = (colour == WHITE) ? 8 : -8;
+	const int THEM = !US;
+	const int Forward = (US == WHITE) ? 8 : -8;
 
 	int sq, flag, eval = 0, pkeval = 0;
 	uint64_t pawns, myPawns, tempPawns, enemyPawns, attacks;
 
 	// Store off pawn attacks for king safety and threat computations
+#ifndef USE_ATTACK_MAPS
 	ei.attackedBy2[US]      = ei.pawnAttacks[US] & ei.attacked[US];
 	ei.attacked[US]        |= ei.pawnAttacks[US];
+#endif
 	ei.attackedBy[US][PAWN] = ei.pawnAttacks[US];
 
 	// Update King Safety calculations
@@ -495,9 +564,10 @@ int evaluatePawns(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateKnights(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateKnights(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int sq, outside, defended, count, eval = 0;
 	uint64_t attacks;
@@ -517,8 +587,10 @@ int evaluateKnights(EvalInfo& ei, Board& board, int colour) {
 
 		// Compute possible attacks and store off information for king safety
 		attacks = knightAttacks(sq);
+#ifndef USE_ATTACK_MAPS
 		ei.attackedBy2[US]        |= attacks & ei.attacked[US];
 		ei.attacked[US]           |= attacks;
+#endif
 		ei.attackedBy[US][KNIGHT] |= attacks;
 
 		// Apply a bonus if the knight is on an outpost square, and cannot be attacked
@@ -553,9 +625,10 @@ int evaluateKnights(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateBishops(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateBishops(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int sq, outside, defended, count, eval = 0;
 	uint64_t attacks;
@@ -581,8 +654,17 @@ int evaluateBishops(EvalInfo& ei, Board& board, int colour) {
 
 		// Compute possible attacks and store off information for king safety
 		attacks = bishopAttacks(sq, ei.occupiedMinusBishops[US]);
+#ifdef USE_ATTACK_MAPS
+		// The maps lack only the x-rays through our bishops and queens
+		if (attacks & board.colours[US] & (board.pieces[BISHOP] | board.pieces[QUEEN])) {
+			uint64_t xrays = attacks & ~bishopAttacks(sq, board.colours[WHITE] | board.colours[BLACK]);
+			ei.attackedBy2[US]    |= xrays & ei.attacked[US];
+			ei.attacked[US]       |= xrays;
+		}
+#else
 		ei.attackedBy2[US]        |= attacks & ei.attacked[US];
 		ei.attacked[US]           |= attacks;
+#endif
 		ei.attackedBy[US][BISHOP] |= attacks;
 
 		// Apply a penalty for the bishop based on number of rammed pawns
@@ -623,9 +705,10 @@ int evaluateBishops(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateRooks(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateRooks(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int sq, open, count, eval = 0;
 	uint64_t attacks;
@@ -646,8 +729,17 @@ int evaluateRooks(EvalInfo& ei, Board& board, int colour) {
 
 		// Compute possible attacks and store off information for king safety
 		attacks = rookAttacks(sq, ei.occupiedMinusRooks[US]);
+#ifdef USE_ATTACK_MAPS
+		// The maps lack only the x-rays through our rooks and queens
+		if (attacks & board.colours[US] & (board.pieces[ROOK] | board.pieces[QUEEN])) {
+			uint64_t xrays = attacks & ~rookAttacks(sq, board.colours[WHITE] | board.colours[BLACK]);
+			ei.attackedBy2[US]  |= xrays & ei.attacked[US];
+			ei.attacked[US]     |= xrays;
+		}
+#else
 		ei.attackedBy2[US]      |= attacks & ei.attacked[US];
 		ei.attacked[US]         |= attacks;
+#endif
 		ei.attackedBy[US][ROOK] |= attacks;
 
 		// Rook is on a semi-open file if there are no pawns of the rook's
@@ -682,9 +774,10 @@ int evaluateRooks(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateQueens(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateQueens(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int sq, count, eval = 0;
 	uint64_t tempQueens, attacks;
@@ -703,8 +796,10 @@ int evaluateQueens(EvalInfo& ei, Board& board, int colour) {
 
 		// Compute possible attacks and store off information for king safety
 		attacks = queenAttacks(sq, board.colours[WHITE] | board.colours[BLACK]);
+#ifndef USE_ATTACK_MAPS
 		ei.attackedBy2[US]       |= attacks & ei.attacked[US];
 		ei.attacked[US]          |= attacks;
+#endif
 		ei.attackedBy[US][QUEEN] |= attacks;
 
 		// Apply a bonus (or penalty) based on the mobility of the queen
@@ -723,9 +818,10 @@ int evaluateQueens(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateKings(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateKings(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int count, dist, blocked, eval = 0;
 
@@ -833,9 +929,10 @@ int evaluateKings(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluatePassed(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluatePassed(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 
 	int sq, rank, dist, flag, canAdvance, safeAdvance, eval = 0;
 
@@ -877,9 +974,10 @@ int evaluatePassed(EvalInfo& ei, Board& board, int colour) {
 	return eval;
 }
 
-int evaluateThreats(EvalInfo& ei, Board& board, int colour) {
+template <int US>
+int evaluateThreats(EvalInfo& ei, Board& board) {
 
-	const int US = colour, THEM = !colour;
+	const int THEM = !US;
 	const uint64_t Rank3Rel = US == WHITE ? RANK_3 : RANK_6;
 
 	int count, eval = 0;
@@ -966,34 +1064,25 @@ int evaluateThreats(EvalInfo& ei, Board& board, int colour) {
 	// Bonus for giving threats by safe pawn pushes
 	count = popcount(pushThreat);
 	eval += count * ThreatByPawnPush;
-	if (TRACE) T.ThreatByPawnPush[colour] += count;
+	if (TRACE) T.ThreatByPawnPush[US] += count;
 
 	return eval;
 }
 
 int evaluateClosedness(EvalInfo& ei, Board& board) {
 
-	int closedness, count, eval = 0;
-
-	uint64_t white = board.colours[WHITE];
-	uint64_t black = board.colours[BLACK];
-
-	uint64_t knights = board.pieces[KNIGHT];
-	uint64_t rooks   = board.pieces[ROOK  ];
+	int count, eval = 0;
+	int closedness = ei.closedness;
 
-	// Compute Closedness factor for this position
-	closedness = 1 * popcount(board.pieces[PAWN])
-					+ 3 * popcount(ei.rammedPawns[WHITE])
-					- 4 * openFileCount(board.pieces[PAWN]);
-	closedness = MAX(0, MIN(8, closedness / 3));
+	const uint64_t key = board.materialKey;
 
 	// Evaluate Knights based on how Closed the position is
-	count = popcount(white & knights) - popcount(black & knights);
+	count = materialCount(key, WHITE_KNIGHT) - materialCount(key, BLACK_KNIGHT);
 	eval += count * ClosednessKnightAdjustment[closedness];
 	if (TRACE) T.ClosednessKnightAdjustment[closedness][WHITE] += count;
 
 	// Evaluate Rooks based on how Closed the position is
-	count = popcount(white & rooks) - popcount(black & rooks);
+	count = materialCount(key, WHITE_ROOK) - materialCount(key, BLACK_ROOK);
 	eval += count * ClosednessRookAdjustment[closedness];
 	if (TRACE) T.ClosednessRookAdjustment[closedness][WHITE] += count;
 
@@ -1078,6 +1167,19 @@ int evaluateScaleFactor(Board& board, int eval) {
 	return SCALE_NORMAL;
 }
 
+int interpolateEvaluation(Board& board, const MaterialEntry& material, int eval, int& factor) {
+
+	// Scale evaluation based on remaining material. Known endgames may scale
+	// it themselves, and the rest are checked only when the material allows
+	const Endgame *endgame = TRACE ? nullptr : material.endgame;
+	factor = endgame && endgame->scale ? endgame->scale(board, endgame->strong)
+		   : material.scaling          ? evaluateScaleFactor(board, eval) : SCALE_NORMAL;
+
+	// Interpolate between the midgame and the scaled endgame by the phase
+	return (ScoreMG(eval) * (256 - material.phase)
+			+  ScoreEG(eval) * material.phase * factor / SCALE_NORMAL) / 256;
+}
+
 void initEvalInfo(EvalInfo& ei, Board& board, PKTable& pktable) {
 
 	uint64_t white   = board.colours[WHITE];
@@ -1088,11 +1190,38 @@ void initEvalInfo(EvalInfo& ei, Board& board, PKTable& pktable) {
 	uint64_t rooks   = board.pieces[ROOK  ] | board.pieces[QUEEN];
 	uint64_t kings   = board.pieces[KING  ];
 
-	// Save some general information about the pawn structure for later
-	ei.pawnAttacks[WHITE]  = pawnAttackSpan(white & pawns, allON, WHITE);
-	ei.pawnAttacks[BLACK]  = pawnAttackSpan(black & pawns, allON, BLACK);
-	ei.rammedPawns[WHITE]  = pawnAdvance(black & pawns, ~(white & pawns), BLACK);
-	ei.rammedPawns[BLACK]  = pawnAdvance(white & pawns, ~(black & pawns), WHITE);
+	// Try to read a hashed Pawn King Eval. Otherwise, start from scratch
+	PKEntry &pkentry = pktable.entries[board.pkhash >> PKT_HASH_SHIFT];
+	if (pktable.nul || pkentry.pkhash != board.pkhash) {
+		ei.pkentry = nullptr;
+		ei.passedPawns   = 0ull;
+		ei.pkeval[WHITE] = 0   ;
+
+		// Save some general information about the pawn structure for later
+		ei.pawnAttacks[WHITE] = pawnAttackSpan(white & pawns, allON, WHITE);
+		ei.pawnAttacks[BLACK] = pawnAttackSpan(black & pawns, allON, BLACK);
+		ei.rammedPawns[WHITE] = pawnAdvance(black & pawns, ~(white & pawns), BLACK);
+		ei.rammedPawns[BLACK] = pawnAdvance(white & pawns, ~(black & pawns), WHITE);
+
+		// Closedness only looks at the Pawns, so it is saved in the PK Table too
+		int closedness = 1 * popcount(pawns)
+						+ 3 * popcount(ei.rammedPawns[WHITE])
+						- 4 * openFileCount(pawns);
+		ei.closedness = MAX(0, MIN(8, closedness / 3));
+	}
+	else {
+		ei.pkentry = &pkentry;
+		ei.passedPawns        = pkentry.passed;
+		ei.pkeval[WHITE]      = pkentry.eval;
+		ei.pawnAttacks[WHITE] = pkentry.pawnAttacks[WHITE];
+		ei.pawnAttacks[BLACK] = pkentry.pawnAttacks[BLACK];
+		ei.rammedPawns[WHITE] = pkentry.rammedPawns[WHITE];
+		ei.rammedPawns[BLACK] = pkentry.rammedPawns[BLACK];
+		ei.closedness         = pkentry.closedness;
+	}
+	ei.pkeval[BLACK] = 0;
+
+	// Blocked Pawns depend on every piece, so they can never be hashed
 	ei.blockedPawns[WHITE] = pawnAdvance(white | black, ~(white & pawns), BLACK);
 	ei.blockedPawns[BLACK] = pawnAdvance(white | black, ~(black & pawns), WHITE);
 
@@ -1107,10 +1236,21 @@ void initEvalInfo(EvalInfo& ei, Board& board, PKTable& pktable) {
 	ei.mobilityAreas[WHITE] = ~(ei.pawnAttacks[BLACK] | (white & kings) | ei.blockedPawns[WHITE]);
 	ei.mobilityAreas[BLACK] = ~(ei.pawnAttacks[WHITE] | (black & kings) | ei.blockedPawns[BLACK]);
 
+#ifdef USE_ATTACK_MAPS
+	// Seed the attack tables from the Board's incremental maps. Only the
+	// x-rays given to Bishops and Rooks are left for the piece evaluations
+	ei.attackedBy[WHITE][KING] = kingAttacks(ei.kingSquare[WHITE]);
+	ei.attackedBy[BLACK][KING] = kingAttacks(ei.kingSquare[BLACK]);
+	ei.attacked[WHITE]    = attackedSquares(board, WHITE);
+	ei.attacked[BLACK]    = attackedSquares(board, BLACK);
+	ei.attackedBy2[WHITE] = attackedTwiceSquares(board, WHITE);
+	ei.attackedBy2[BLACK] = attackedTwiceSquares(board, BLACK);
+#else
 	// Init part of the attack tables. By doing this step here, evaluatePawns()
 	// can start by setting up the attackedBy2 table, since King attacks are resolved
 	ei.attacked[WHITE] = ei.attackedBy[WHITE][KING] = kingAttacks(ei.kingSquare[WHITE]);
 	ei.attacked[BLACK] = ei.attackedBy[BLACK][KING] = kingAttacks(ei.kingSquare[BLACK]);
+#endif
 
 	// For mobility, we allow bishops to attack through each other
 	ei.occupiedMinusBishops[WHITE] = (white | black) ^ (white & bishops);
@@ -1124,21 +1264,121 @@ void initEvalInfo(EvalInfo& ei, Board& board, PKTable& pktable) {
 	ei.kingAttacksCount[WHITE]    = ei.kingAttacksCount[BLACK]    = 0;
 	ei.kingAttackersCount[WHITE]  = ei.kingAttackersCount[BLACK]  = 0;
 	ei.kingAttackersWeight[WHITE] = ei.kingAttackersWeight[BLACK] = 0;
+}
 
-	// Try to read a hashed Pawn King Eval. Otherwise, start from scratch
+void printEvaluation(Board& board) {
 
-	PKEntry &pkentry =pktable.entries[board.pkhash >> PKT_HASH_SHIFT];
-	if (pktable.nul || pkentry.pkhash != board.pkhash) {
-		ei.pkentry = nullptr;
-		ei.passedPawns   = 0ull;
-		ei.pkeval[WHITE] = 0   ;
+	EvalInfo ei;
+	int terms[EVAL_COMPONENT_NB][COLOUR_NB] = {{0}};
+	int material[COLOUR_NB] = {0};
+	int eval, factor, closedness, complexity, before;
+
+	// Material and PSQT are tracked incrementally as one sum. Split it by colour
+	for (int sq = 0; sq < SQUARE_NB; ++sq)
+		if (board.squares[sq] != EMPTY)
+			material[pieceColour(board.squares[sq])] += PSQT[board.squares[sq]][sq];
+
+	// Repeat evaluatePieces(), crediting the Pawn King terms to their owners
+	initEvalInfo(ei, board, NoPKTable);
+	for (int i = EVAL_PAWNS; i <= EVAL_THREATS; ++i) {
+		for (int colour = WHITE; colour <= BLACK; ++colour) {
+			before = ei.pkeval[colour];
+			terms[i][colour]  = EvalTerms[i - EVAL_PAWNS][colour](ei, board);
+			terms[i][colour] += ei.pkeval[colour] - before;
+		}
 	}
-	else {
-			ei.pkentry = &pkentry;
-			ei.passedPawns   = pkentry.passed;
-			ei.pkeval[WHITE] = pkentry.eval;
+
+	eval = board.psqtmat;
+	for (int i = EVAL_PAWNS; i <= EVAL_THREATS; ++i)
+		eval += terms[i][WHITE] - terms[i][BLACK];
+
+	closedness = evaluateClosedness(ei, board);
+	complexity = evaluateComplexity(ei, board, eval + closedness);
+	eval += closedness + complexity;
+
+	MaterialEntry mentry;
+	initMaterialEntry(mentry, board.materialKey);
+
+	const Endgame *endgame = TRACE ? nullptr : mentry.endgame;
+	const int tapered = interpolateEvaluation(board, mentry, eval, factor);
+
+	printf("\n         Term |    White    |    Black    |    Total\n");
+	printf("              |   MG    EG  |   MG    EG  |   MG    EG\n");
+	printf(" -------------+-------------+-------------+-------------\n");
+
+	printf("%13s | %5d %5d | %5d %5d | %5d %5d\n", "Material",
+		ScoreMG(material[WHITE]), ScoreEG(material[WHITE]),
+		-ScoreMG(material[BLACK]), -ScoreEG(material[BLACK]),
+		ScoreMG(board.psqtmat), ScoreEG(board.psqtmat));
+
+	for (int i = EVAL_PAWNS; i <= EVAL_THREATS; ++i)
+		printf("%13s | %5d %5d | %5d %5d | %5d %5d\n", EvalComponentNames[i],
+			ScoreMG(terms[i][WHITE]), ScoreEG(terms[i][WHITE]),
+			ScoreMG(terms[i][BLACK]), ScoreEG(terms[i][BLACK]),
+			ScoreMG(terms[i][WHITE] - terms[i][BLACK]),
+			ScoreEG(terms[i][WHITE] - terms[i][BLACK]));
+
+	printf("%13s |   ---   --- |   ---   --- | %5d %5d\n", "Closedness",
+		ScoreMG(closedness), ScoreEG(closedness));
+	printf("%13s |   ---   --- |   ---   --- | %5d %5d\n", "Complexity",
+		ScoreMG(complexity), ScoreEG(complexity));
+
+	printf(" -------------+-------------+-------------+-------------\n");
+	printf("%13s |   ---   --- |   ---   --- | %5d %5d\n\n", "Total",
+		ScoreMG(eval), ScoreEG(eval));
+
+	// As evaluateBoard(), which reports for the side to move instead
+	eval = endgame && endgame->evaluate ? endgame->evaluate(board, endgame->strong)
+		 : tapered + (board.turn == WHITE ? Tempo : -Tempo);
+	eval = board.turn == WHITE ? eval : -eval;
+
+	printf("Phase        : %d / 256\n", mentry.phase);
+	printf("Scale Factor : %d / %d\n", factor, SCALE_NORMAL);
+	if (endgame && endgame->evaluate)
+		printf("Endgame      : specialised evaluation replaces the terms above\n");
+	printf("Evaluation   : %d (White), %d (side to move)\n\n",
+		board.turn == WHITE ? eval : -eval, eval);
+}
+
+int timeEvaluation(Board& board, PKTable& pktable, MaterialTable& mtable, uint64_t ns[EVAL_COMPONENT_NB]) {
+
+	using namespace std::chrono;
+
+	EvalInfo ei;
+	int eval, factor;
+	steady_clock::time_point last = steady_clock::now();
+
+	// Charge the time since the previous lap to the given component. Each lap
+	// costs one clock read, which the caller is expected to calibrate for
+	auto lap = [&](int component) {
+		steady_clock::time_point now = steady_clock::now();
+		ns[component] += duration_cast<nanoseconds>(now - last).count();
+		last = now;
+	};
+
+	// Mirror evaluateBoard(), but stop the clock after every component
+	const MaterialEntry& material = getMaterialEntry(mtable, board.materialKey);
+	initEvalInfo(ei, board, pktable);
+	lap(EVAL_INIT);
+
+	eval = 0;
+	for (int i = EVAL_PAWNS; i <= EVAL_THREATS; ++i) {
+		eval += EvalTerms[i - EVAL_PAWNS][WHITE](ei, board);
+		eval -= EvalTerms[i - EVAL_PAWNS][BLACK](ei, board);
+		lap(i);
 	}
-	ei.pkeval[BLACK] = 0;
+
+	eval += ei.pkeval[WHITE] - ei.pkeval[BLACK] + board.psqtmat;
+	eval += evaluateClosedness(ei, board);
+	lap(EVAL_CLOSEDNESS);
+
+	eval += evaluateComplexity(ei, board, eval);
+	lap(EVAL_COMPLEXITY);
+
+	eval = interpolateEvaluation(board, material, eval, factor);
+	lap(EVAL_SCALE_FACTOR);
+
+	return eval;
 }
 
 void initEval() {
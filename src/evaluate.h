@@ -36,6 +36,12 @@ enum {
 	SCALE_NORMAL           = 128,
 };
 
+enum {
+	EVAL_INIT, EVAL_PAWNS, EVAL_KNIGHTS, EVAL_BISHOPS, EVAL_ROOKS, EVAL_QUEENS,
+	EVAL_KINGS, EVAL_PASSED, EVAL_THREATS, EVAL_CLOSEDNESS, EVAL_COMPLEXITY,
+	EVAL_SCALE_FACTOR, EVAL_COMPONENT_NB
+};
+
 struct EvalTrace {
 	int PawnValue[COLOUR_NB];
 	int KnightValue[COLOUR_NB];
@@ -113,22 +119,29 @@ struct EvalInfo {
 	PKEntry *pkentry;
 };
 
-int evaluateBoard(Board& board, PKTable& pktable);
+int evaluateBoard(Board& board, PKTable& pktable, MaterialTable& mtable);
+MaterialEntry& getMaterialEntry(MaterialTable& mtable, uint64_t materialKey);
+void initMaterialEntry(MaterialEntry& entry, uint64_t materialKey);
 int evaluatePieces(EvalInfo& ei, Board& board);
-int evaluatePawns(EvalInfo& ei, Board& board, int colour);
-int evaluateKnights(EvalInfo& ei, Board& board, int colour);
-int evaluateBishops(EvalInfo& ei, Board& board, int colour);
-int evaluateRooks(EvalInfo& ei, Board& board, int colour);
-int evaluateQueens(EvalInfo& ei, Board& board, int colour);
-int evaluateKings(EvalInfo& ei, Board& board, int colour);
-int evaluatePassed(EvalInfo& ei, Board& board, int colour);
-int evaluateThreats(EvalInfo& ei, Board& board, int colour);
+template <int US> int evaluatePawns(EvalInfo& ei, Board& board);
+template <int US> int evaluateKnights(EvalInfo& ei, Board& board);
+template <int US> int evaluateBishops(EvalInfo& ei, Board& board);
+template <int US> int evaluateRooks(EvalInfo& ei, Board& board);
+template <int US> int evaluateQueens(EvalInfo& ei, Board& board);
+template <int US> int evaluateKings(EvalInfo& ei, Board& board);
+template <int US> int evaluatePassed(EvalInfo& ei, Board& board);
+template <int US> int evaluateThreats(EvalInfo& ei, Board& board);
 int evaluateClosedness(EvalInfo& ei, Board& board);
 int evaluateComplexity(EvalInfo& ei, Board& board, int eval);
 int evaluateScaleFactor(Board& board, int eval);
+int interpolateEvaluation(Board& board, const MaterialEntry& material, int eval, int& factor);
 void initEvalInfo(EvalInfo& ei, Board& board, PKTable& pktable);
 void initEval();
 
+extern const char *EvalComponentNames[EVAL_COMPONENT_NB];
+void printEvaluation(Board& board);
+int timeEvaluation(Board& board, PKTable& pktable, MaterialTable& mtable, uint64_t ns[EVAL_COMPONENT_NB]);
+
 #define MakeScore(mg, eg) (int((unsigned int)(eg) << 16) + (mg))
 #define ScoreMG(s) (int16_t(uint16_t((unsigned)((s)))))
 #define ScoreEG(s) (int16_t(uint16_t((unsigned)((s) + 0x8000) >> 16)))
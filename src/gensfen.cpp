@@ -0,0 +1,347 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "gensfen.h"
+#include "move.h"
+#include "movegen.h"
+#include "packed.h"
+#include "search.h"
+#include "thread.h"
+#include "time.h"
+#include "transposition.h"
+#include "types.h"
+
+namespace {
+
+const char *StartFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+struct GenSettings {
+    const char *output;
+    int games, depth, workers, megabytes, randomPlies, binary;
+    uint64_t nodes, seed;
+    vector<string> book;
+};
+
+// Everything the workers share. The lock guards the output, the counters,
+// and the claiming of games, all of which happen once per game at most
+
+struct GenShared {
+    const GenSettings *settings;
+    FILE *fout;
+    pthread_mutex_t lock;
+    int started, finished;
+    uint64_t positions;
+    double start;
+};
+
+struct GenWorker {
+    GenShared *shared;
+    int index;
+};
+
+uint64_t nextRandom(uint64_t& state) {
+
+    // SplitMix64, which is good enough to pick moves and openings with,
+    // and cheap to seed differently for each of the workers
+
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void playMove(Board& board, RepetitionStack& game, uint16_t move) {
+
+    Undo undo;
+
+    // Keep the keys of the game as uciPosition() would for a search
+    reserveRepetitionStack(game, board.numMoves + 1);
+    game.keys[board.numMoves] = board.hash;
+    applyMove(board, move, undo);
+
+    if (board.halfMoveCounter == 0) board.numMoves = 0;
+}
+
+int playOpening(Board& board, RepetitionStack& game, const GenSettings& settings, uint64_t& prng, int fallback) {
+
+    int size;
+    uint16_t moves[MAX_MOVES];
+
+    // Start from a random book position, or the usual starting position,
+    // and play some random moves. Openings which end the game are dropped.
+    // The fallback is the starting position as it is, which never fails
+
+    const vector<string>& book = settings.book;
+    const int randomPlies = fallback ? 0 : settings.randomPlies;
+    boardFromFEN(board, fallback || book.empty() ? StartFEN : book[nextRandom(prng) % book.size()].c_str(), 0);
+
+    for (int ply = 0; ply < randomPlies; ++ply) {
+        size = 0, genAllLegalMoves(board, moves, size);
+        if (!size) return 0;
+        playMove(board, game, moves[nextRandom(prng) % size]);
+    }
+
+    size = 0, genAllLegalMoves(board, moves, size);
+    return size && !boardIsDrawn(board, game.keys, 0);
+}
+
+int playGame(Thread *threads, RepetitionStack& game, vector<PackedBoard>& records,
+             const GenSettings& settings, uint64_t& prng, int checkOpening, int fallback) {
+
+    Board board;
+    Limits limits = {};
+    PackedBoard packed;
+    uint16_t best, ponder, moves[MAX_MOVES];
+    int size, score, white, winner, lastWinner = PACKED_NO_RESULT;
+    int resignPlies = 0, drawPlies = 0;
+
+    if (!playOpening(board, game, settings, prng, fallback))
+        return PACKED_NO_RESULT;
+
+    // Fixed depth or fixed node searches, without any output
+    limits.limitedByDepth = settings.depth != 0;
+    limits.limitedByNodes = settings.nodes != 0;
+    limits.depthLimit     = settings.depth;
+    limits.nodeLimit      = settings.nodes;
+    limits.multiPV        = 1;
+    limits.silent         = 1;
+
+    for (int ply = 0; ; ++ply) {
+
+        // Games end by the rules before any adjudication
+        size = 0, genAllLegalMoves(board, moves, size);
+        if (!size) return !board.kingAttackers   ? PACKED_DRAW
+                        :  board.turn == WHITE   ? PACKED_BLACK_WIN : PACKED_WHITE_WIN;
+
+        if (boardIsDrawn(board, game.keys, 0) || ply >= GenMaxPlies)
+            return PACKED_DRAW;
+
+        limits.start = getRealTime();
+        getBestMove(threads, board, game.keys, limits, best, ponder);
+        score = threads->values[0];
+
+        if (checkOpening && ply == 0 && abs(score) > GenOpeningScore)
+            return PACKED_NO_RESULT;
+
+        // Only quiet positions are kept, where the score of the search is
+        // best explained by the evaluation. Mate scores are left out as well
+        if (!board.kingAttackers && !moveIsTactical(board, best) && abs(score) < MATE_IN_MAX) {
+            packBoard(board, packed);
+            packed.score = board.turn == WHITE ? score : -score;
+            packed.move  = best;
+            records.push_back(packed);
+        }
+
+        // Adjudicate once both sides agree on a decisive result, meaning the
+        // same colour is winning from White's point of view on consecutive
+        // plies, or after a long enough stretch of level scores late on
+        white  = board.turn == WHITE ? score : -score;
+        winner = white >=  GenResignScore ? PACKED_WHITE_WIN
+               : white <= -GenResignScore ? PACKED_BLACK_WIN : PACKED_NO_RESULT;
+
+        resignPlies = winner == PACKED_NO_RESULT ? 0 : winner == lastWinner ? resignPlies + 1 : 1;
+        drawPlies   = ply >= GenDrawPly && abs(score) <= GenDrawScore ? drawPlies + 1 : 0;
+        lastWinner  = winner;
+
+        if (resignPlies >= GenResignPlies)
+            return winner;
+
+        if (drawPlies >= GenDrawPlies)
+            return PACKED_DRAW;
+
+        playMove(board, game, best);
+    }
+}
+
+void *generateGames(void *vworker) {
+
+    GenWorker *const worker = (GenWorker*)vworker;
+    GenShared& shared = *worker->shared;
+    const GenSettings& settings = *shared.settings;
+
+    // Each worker plays its own games with its own single Thread pool.
+    // The Transposition Table is shared by all, as in any SMP search.
+    // ABORT_SIGNAL is never raised here, so it is left alone
+    Thread *threads = createThreadPool(1);
+    RepetitionStack game = {};
+    vector<PackedBoard> records;
+    uint64_t prng = settings.seed ^ (0xD1B54A32D192ED03ull * (worker->index + 1));
+
+    while (1) {
+
+        // Age the shared Table once per game rather than once per search,
+        // under the lock, as the searches of the workers overlap. Each game
+        // still ages the entries of the others, which is left to replacement
+        pthread_mutex_lock(&shared.lock);
+        const int claimed = shared.started < settings.games ? ++shared.started : 0;
+        if (claimed) updateTT();
+        pthread_mutex_unlock(&shared.lock);
+
+        if (!claimed) break;
+
+        // Retry openings which were already decided, unless the book
+        // seems to hold nothing else, so that we always make progress.
+        // Openings which keep ending the game before it starts, as from
+        // a book of finished positions, give way to the starting position
+        int result, attempts = 0;
+
+        do {
+            records.clear();
+            resetThreadPool(threads);
+            ++attempts;
+            result = playGame(threads, game, records, settings, prng, attempts < 16, attempts > 64);
+        } while (result == PACKED_NO_RESULT);
+
+        for (PackedBoard& packed : records)
+            packed.result = result;
+
+        pthread_mutex_lock(&shared.lock);
+
+        if (settings.binary)
+            fwrite(records.data(), sizeof(PackedBoard), records.size(), shared.fout);
+        else for (const PackedBoard& packed : records)
+            writePackedFEN(shared.fout, packed);
+
+        shared.finished++;
+        shared.positions += records.size();
+
+        const double hours = (getRealTime() - shared.start) / 3600000.0;
+        printf("\rGames %d of %d, %" PRIu64 " positions, %.0f positions/hour",
+            shared.finished, settings.games, shared.positions, shared.positions / hours);
+        fflush(stdout);
+
+        pthread_mutex_unlock(&shared.lock);
+    }
+
+    deleteRepetitionStack(game);
+    deleteThreadPool(threads);
+    return nullptr;
+}
+
+int usage() {
+    printf("Usage: gensfen output=<file> [games=1000] [depth=8] [nodes=0] [workers=<cores>]\n"
+           "               [hash=64] [book=<file>] [random=8] [seed=1] [format=text|bin]\n");
+    return 1;
+}
+
+}
+
+int runGenerateFENs(int argc, char **argv) {
+
+    GenSettings settings;
+    GenShared shared = {};
+    char line[512];
+
+    settings.output      = nullptr;
+    settings.games       = 1000;
+    settings.depth       = 0;
+    settings.workers     = MAX(1, (int)std::thread::hardware_concurrency());
+    settings.megabytes   = 64;
+    settings.randomPlies = 8;
+    settings.binary      = 0;
+    settings.nodes       = 0;
+    settings.seed        = 1;
+
+    // Usage: gensfen key=value ... Plays games against itself, and writes
+    // the quiet positions of each with the score of the search and the
+    // result of the game. Text output is read by the Texel Tuner, and the
+    // binary output is a file of PackedBoards. See usage() for the keys
+
+    for (int i = 2; i < argc; ++i) {
+
+        const char *value = strchr(argv[i], '=');
+        if (value == nullptr) return usage();
+
+        const string key(argv[i], value++ - argv[i]);
+
+        if      (key == "output" ) settings.output      = value;
+        else if (key == "games"  ) settings.games       = atoi(value);
+        else if (key == "depth"  ) settings.depth       = atoi(value);
+        else if (key == "nodes"  ) settings.nodes       = strtoull(value, nullptr, 10);
+        else if (key == "workers") settings.workers     = MAX(1, atoi(value));
+        else if (key == "hash"   ) settings.megabytes   = atoi(value);
+        else if (key == "random" ) settings.randomPlies = atoi(value);
+        else if (key == "seed"   ) settings.seed        = strtoull(value, nullptr, 0);
+        else if (key == "format" ) settings.binary      = !strcmp(value, "bin");
+
+        else if (key == "book") {
+            FILE *fin = fopen(value, "r");
+            if (fin == nullptr) { printf("Unable to open %s\n", value); return 1; }
+            while (fgets(line, sizeof(line), fin))
+                if (strchr(line, '/')) settings.book.push_back(line);
+            fclose(fin);
+        }
+
+        else return usage();
+    }
+
+    if (settings.output == nullptr)
+        return usage();
+
+    // Searches are to a fixed depth, unless only a node count was given
+    if (!settings.depth && !settings.nodes)
+        settings.depth = 8;
+
+    shared.fout = fopen(settings.output, settings.binary ? "ab" : "a");
+    if (shared.fout == nullptr) {
+        printf("Unable to open %s\n", settings.output);
+        return 1;
+    }
+
+    initTT(settings.megabytes);
+
+    shared.settings = &settings;
+    shared.start    = getRealTime();
+    pthread_mutex_init(&shared.lock, nullptr);
+
+    vector<GenWorker> workers(settings.workers);
+    vector<pthread_t> pthreads(settings.workers);
+
+    for (int i = 0; i < settings.workers; ++i) {
+        workers[i].shared = &shared, workers[i].index = i;
+        pthread_create(&pthreads[i], nullptr, generateGames, &workers[i]);
+    }
+
+    for (int i = 0; i < settings.workers; ++i)
+        pthread_join(pthreads[i], nullptr);
+
+    pthread_mutex_destroy(&shared.lock);
+    fclose(shared.fout);
+
+    const double seconds = (getRealTime() - shared.start) / 1000.0;
+
+    printf("\n\nGames     : %d\n", shared.finished);
+    printf("Positions : %" PRIu64 " (%.1f per game)\n", shared.positions, shared.positions / (double)MAX(1, shared.finished));
+    printf("Time      : %.1f seconds, with %d workers\n", seconds, settings.workers);
+    printf("Rate      : %.0f positions/hour (%.0f per worker)\n",
+        3600.0 * shared.positions / seconds, 3600.0 * shared.positions / seconds / settings.workers);
+
+    return 0;
+}
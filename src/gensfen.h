@@ -0,0 +1,30 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+int runGenerateFENs(int argc, char **argv);
+
+static const int GenOpeningScore = 400;  // Openings scored beyond this are dropped
+static const int GenResignScore  = 2000; // Scores which end a game once both sides agree
+static const int GenResignPlies  = 4;
+static const int GenDrawPly      = 80;   // Draws are adjudicated after this many plies
+static const int GenDrawScore    = 10;
+static const int GenDrawPlies    = 8;
+static const int GenMaxPlies     = 400;
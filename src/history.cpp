@@ -25,6 +25,13 @@
 #include "thread.h"
 #include "types.h"
 
+static int capturedPiece(Board& board, uint16_t move) {
+
+    // En passant always captures a Pawn. Promotions without a capture land
+    // on an empty square, and pieceType(EMPTY) == PIECE_NB has its own slot
+    return MoveType(move) == ENPASS_MOVE ? PAWN : pieceType(board.squares[MoveTo(move)]);
+}
+
 void updateHistoryHeuristics(Thread *thread, uint16_t *moves, int length, int height, int bonus) {
 
     int entry, colour = thread->board.turn;
@@ -60,16 +67,16 @@ void updateHistoryHeuristics(Thread *thread, uint16_t *moves, int length, int he
 
         // Update Counter Move History
         if (counter != NONE_MOVE && counter != NULL_MOVE) {
-            entry = thread->continuation[0][cmPiece][cmTo][piece][to];
+            entry = (*thread->continuation)[0][cmPiece][cmTo][piece][to];
             entry += HistoryMultiplier * delta - entry * abs(delta) / HistoryDivisor;
-            thread->continuation[0][cmPiece][cmTo][piece][to] = entry;
+            (*thread->continuation)[0][cmPiece][cmTo][piece][to] = entry;
         }
 
         // Update Followup Move History
         if (follow != NONE_MOVE && follow != NULL_MOVE) {
-            entry = thread->continuation[1][fmPiece][fmTo][piece][to];
+            entry = (*thread->continuation)[1][fmPiece][fmTo][piece][to];
             entry += HistoryMultiplier * delta - entry * abs(delta) / HistoryDivisor;
-            thread->continuation[1][fmPiece][fmTo][piece][to] = entry;
+            (*thread->continuation)[1][fmPiece][fmTo][piece][to] = entry;
         }
     }
 
@@ -84,6 +91,39 @@ void updateHistoryHeuristics(Thread *thread, uint16_t *moves, int length, int he
         thread->cmtable[!colour][cmPiece][cmTo] = bestMove;
 }
 
+void updateCaptureHistories(Thread *thread, uint16_t best, uint16_t *moves, int length, int bonus) {
+
+    int entry;
+
+    // Cap update size to avoid saturation
+    bonus = MIN(bonus, HistoryMax);
+
+    for (int i = 0; i < length; ++i) {
+
+        // Apply a malus to every noisy move but the one which failed high
+        int delta = (moves[i] == best) ? bonus : -bonus;
+
+        // Extract information from this move
+        int to = MoveTo(moves[i]);
+        int piece = pieceType(thread->board.squares[MoveFrom(moves[i])]);
+        int captured = capturedPiece(thread->board, moves[i]);
+
+        entry = thread->chistory[piece][to][captured];
+        entry += HistoryMultiplier * delta - entry * abs(delta) / HistoryDivisor;
+        thread->chistory[piece][to][captured] = entry;
+    }
+}
+
+int getCaptureHistory(Thread *thread, uint16_t move) {
+
+    // Extract information from this move
+    int to = MoveTo(move);
+    int piece = pieceType(thread->board.squares[MoveFrom(move)]);
+    int captured = capturedPiece(thread->board, move);
+
+    return thread->chistory[piece][to][captured];
+}
+
 void getHistory(Thread *thread, uint16_t move, int height, int *hist, int *cmhist, int *fmhist) {
 
     // Extract information from this move
@@ -106,15 +146,17 @@ void getHistory(Thread *thread, uint16_t move, int height, int *hist, int *cmhis
 
     // Set Counter Move History if it exists
     if (counter == NONE_MOVE || counter == NULL_MOVE) *cmhist = 0;
-    else *cmhist = thread->continuation[0][cmPiece][cmTo][piece][to];
+    else *cmhist = (*thread->continuation)[0][cmPiece][cmTo][piece][to];
 
     // Set Followup Move History if it exists
     if (follow == NONE_MOVE || follow == NULL_MOVE) *fmhist = 0;
-    else *fmhist = thread->continuation[1][fmPiece][fmTo][piece][to];
+    else *fmhist = (*thread->continuation)[1][fmPiece][fmTo][piece][to];
 }
 
 void getHistoryScores(Thread *thread, uint16_t *moves, int *scores, int start, int length, int height) {
 
+    static const int16_t NoHistory[PIECE_NB][SQUARE_NB] = {};
+
     // Extract information from last move
     uint16_t counter = thread->moveStack[height-1];
     int cmPiece = thread->pieceStack[height-1];
@@ -125,23 +167,25 @@ void getHistoryScores(Thread *thread, uint16_t *moves, int *scores, int start, i
     int fmPiece = thread->pieceStack[height-2];
     int fmTo = MoveTo(follow);
 
-    for (int i = start; i < start + length; ++i) {
+    // Resolve each table once, using an empty table in place of the
+    // Counter Move and Followup Move Histories when they don't exist,
+    // so that every move is scored in a single pass without branching
+    const int16_t (*history)[SQUARE_NB] = thread->history[thread->board.turn];
 
-        // Extract information from this move
-        int to = MoveTo(moves[i]);
-        int from = MoveFrom(moves[i]);
-        int piece = pieceType(thread->board.squares[from]);
+    const int16_t (*cmhist)[SQUARE_NB] = counter != NONE_MOVE && counter != NULL_MOVE
+                                       ? (*thread->continuation)[0][cmPiece][cmTo] : NoHistory;
+
+    const int16_t (*fmhist)[SQUARE_NB] = follow != NONE_MOVE && follow != NULL_MOVE
+                                       ? (*thread->continuation)[1][fmPiece][fmTo] : NoHistory;
 
-        // Start with the basic Butterfly history
-        scores[i] = thread->history[thread->board.turn][from][to];
+    for (int i = start; i < start + length; ++i) {
 
-        // Add Counter Move History if it exists
-        if (counter != NONE_MOVE && counter != NULL_MOVE)
-            scores[i] += thread->continuation[0][cmPiece][cmTo][piece][to];
+        // Extract information from this move
+        const int to = MoveTo(moves[i]);
+        const int from = MoveFrom(moves[i]);
+        const int piece = pieceType(thread->board.squares[from]);
 
-        // Add Followup Move History if it exists
-        if (follow != NONE_MOVE && follow != NULL_MOVE)
-            scores[i] += thread->continuation[1][fmPiece][fmTo][piece][to];
+        scores[i] = history[from][to] + cmhist[piece][to] + fmhist[piece][to];
     }
 }
 
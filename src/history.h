@@ -26,7 +26,12 @@ static const int HistoryMax = 400,
 HistoryMultiplier = 32,
 HistoryDivisor = 512;
 
+// Capture History is scaled down by this before being added to MVV-LVA
+static const int CaptureHistoryDivisor = 64;
+
 void updateHistoryHeuristics(Thread *thread, uint16_t *moves, int length, int height, int bonus);
 void getHistory(Thread *thread, uint16_t move, int height, int *hist, int *cmhist, int *fmhist);
 void getHistoryScores(Thread *thread, uint16_t *moves, int *scores, int start, int length, int height);
+void updateCaptureHistories(Thread *thread, uint16_t best, uint16_t *moves, int length, int bonus);
+int getCaptureHistory(Thread *thread, uint16_t move);
 void getRefutationMoves(Thread *thread, int height, uint16_t *killer1, uint16_t *killer2, uint16_t *counter);
@@ -0,0 +1,798 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+// Bitbase for King and Pawn versus King, with a set bit for each position
+// which is won for White. Indexed as kpkIndex() in endgame.cpp, with White
+// holding the Pawn on files A through D. The table is the output of the
+// retrograde analysis in endgame.cpp, which rebuilds it to check against
+// these values in builds without NDEBUG
+
+static const uint64_t KPKBitbase[3072] = {
+    0xFFFFFFFFFFFFFCFCull, 0xFFFFFFFFFFFFF8F8ull, 0xFFFFFFFFFFFFF0F1ull, 0xFFFFFFFFFFFFE2E3ull,
+    0xFFFFFFFFFFFFC6C7ull, 0xFFFFFFFFFFFF8E8Full, 0xFFFFFFFFFFFF1E1Full, 0xFFFFFFFFFFFF3E3Full,
+    0x0000000000000000ull, 0xFFFFFFFFFFF8F8F8ull, 0xFFFFFFFFFFF1F0F1ull, 0xFFFFFFFFFFE3E2E3ull,
+    0xFFFFFFFFFFC7C6C7ull, 0xFFFFFFFFFF8F8E8Full, 0xFFFFFFFFFF1F1E1Full, 0xFFFFFFFFFF3F3E3Full,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x00000F0F01000000ull, 0x00071F1F03030200ull,
+    0x0F0F3F3F07070600ull, 0x1F1F7F7F0F0F0E00ull, 0xFFFFFFFF1F1F1EFFull, 0xFFFFFFFF3F3F3EFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0007070303030000ull,
+    0x0F0F0F0707070000ull, 0x1F1F1F0F0F0F0000ull, 0xFFFFFF1F1F1FFEFFull, 0xFFFFFF3F3F3FFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0007030303000000ull,
+    0x0F0F070707000000ull, 0x1F1F0F0F0F000000ull, 0xFFFF1F1F1FFFFEFFull, 0xFFFF3F3F3FFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0003030300000000ull,
+    0x0F07070700000000ull, 0x1F0F0F0F1F000000ull, 0xFF1F1F1FFFFFFEFFull, 0xFF3F3F3FFFFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303030000000000ull,
+    0x0707070F00000000ull, 0x0F0F0F1F1F000000ull, 0x1F1F1FFFFFFFFEFFull, 0x3F3F3FFFFFFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303070000000000ull,
+    0x07070F0F00000000ull, 0x0F0F1F1F1F000000ull, 0x1F1FFFFFFFFFFEFFull, 0x3F3FFFFFFFFFFEFFull,
+    0x0000000000030000ull, 0x0000000000030000ull, 0xFFFFFFFFFFFFF0F1ull, 0xFFFFFFFFFFFFE2E3ull,
+    0xFFFFFFFFFFFFC6C7ull, 0xFFFFFFFFFFFF8E8Full, 0xFFFFFFFFFFFF1E1Full, 0xFFFFFFFFFFFF3E3Full,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x00000F0F0F000000ull, 0x00000F0F0F020200ull,
+    0x00071F1F1F070600ull, 0x0F0F3F3F3F0F0E00ull, 0x1F1F7F7F7F1F1E00ull, 0xFFFFFFFFFF3F3E3Full,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000600000000ull, 0x0000020E02020000ull,
+    0x0007071F07070000ull, 0x0F0F0F3F0F0F0000ull, 0x1F1F1F7F1F1F0000ull, 0xFFFFFFFF3F3F3EFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020202000000ull,
+    0x0007070707000000ull, 0x0F0F0F0F0F000000ull, 0x1F1F1F1F1F000000ull, 0xFFFFFF3F3F3FFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020200000000ull,
+    0x0007070700000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0xFFFF3F3F3FFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull,
+    0x0007070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0xFF3F3F3FFFFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0002000000000000ull,
+    0x0007070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0x3F3F3FFFFFFFFEFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0707070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0x3F3FFFFFFFFFFEFFull,
+    0xFFFFFFFFFFFFFCFCull, 0xFFFFFFFFFFFFF8F8ull, 0xFFFFFFFFFFFFF1F1ull, 0xFFFFFFFFFFFFE1E3ull,
+    0xFFFFFFFFFFFFC5C7ull, 0xFFFFFFFFFFFF8D8Full, 0xFFFFFFFFFFFF1D1Full, 0xFFFFFFFFFFFF3D3Full,
+    0xFFFFFFFFFFFCFCFCull, 0x0000000000000000ull, 0xFFFFFFFFFFF1F1F1ull, 0xFFFFFFFFFFE3E1E3ull,
+    0xFFFFFFFFFFC7C5C7ull, 0xFFFFFFFFFF8F8D8Full, 0xFFFFFFFFFF1F1D1Full, 0xFFFFFFFFFF3F3D3Full,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00001F1F03030103ull,
+    0x000F3F3F0707050Full, 0x1F1F7F7F0F0F0D1Full, 0x3F3FFFFF1F1F1D3Full, 0xFFFFFFFF3F3F3DFFull,
+    0x0000000C0C0C0C00ull, 0x0000000000000000ull, 0x0000000101010100ull, 0x0000070303030503ull,
+    0x000F0F0707070D0Full, 0x1F1F1F0F0F0F1D1Full, 0x3F3F3F1F1F1F3D3Full, 0xFFFFFF3F3F3FFDFFull,
+    0x00000C0C0C0E0D00ull, 0x0000000000050500ull, 0x00000101010B0D00ull, 0x0000030303171D03ull,
+    0x000F0707072F3D0Full, 0x1F1F0F0F0F5F7D1Full, 0x3F3F1F1F1FBFFD3Full, 0xFFFF3F3F3FFFFDFFull,
+    0x000C0C0C0F0F0C00ull, 0x000000080F0F0000ull, 0x000101010F0F0100ull, 0x000303031F1F0503ull,
+    0x000707073F3F0D0Full, 0x1F0F0F0F7F7F1D1Full, 0x3F1F1F1FFFFF3D3Full, 0xFF3F3F3FFFFFFDFFull,
+    0x0C0C1C1F1F1F1D00ull, 0x0000181F1F1F1D00ull, 0x0101111F1F1F1D00ull, 0x0303031F1F1F1D03ull,
+    0x0707073F3F3F3D0Full, 0x0F0F0F7F7F7F7D1Full, 0x1F1F1FFFFFFFFD3Full, 0x3F3F3FFFFFFFFDFFull,
+    0x0C3C3F3F3F3F3D3Full, 0x00383F3F3F3F3D3Full, 0x01313F3F3F3F3D3Full, 0x03233F3F3F3F3D3Full,
+    0x07073F3F3F3F3D3Full, 0x0F0F7F7F7F7F7D7Full, 0x1F1FFFFFFFFFFDFFull, 0x3F3FFFFFFFFFFDFFull,
+    0x0000000000070404ull, 0x0000000000070000ull, 0x0000000000070101ull, 0xFFFFFFFFFFFFE1E3ull,
+    0xFFFFFFFFFFFFC5C7ull, 0xFFFFFFFFFFFF8D8Full, 0xFFFFFFFFFFFF1D1Full, 0xFFFFFFFFFFFF3D3Full,
+    0x0000000000040400ull, 0x0000000000000000ull, 0x0000000000010100ull, 0x00001F1F1F030103ull,
+    0x00001F1F1F070503ull, 0x000F3F3F3F0F0D0Full, 0x1F1F7F7F7F1F1D1Full, 0x3F3FFFFFFF3F3D3Full,
+    0x0000000000040000ull, 0x0000000000000000ull, 0x0000000000010000ull, 0x0000000F03030100ull,
+    0x0000071F07070503ull, 0x000F0F3F0F0F0D0Full, 0x1F1F1F7F1F1F1D1Full, 0x3F3F3FFF3F3F3D3Full,
+    0x0000000004040000ull, 0x0000000000000000ull, 0x0000000001010000ull, 0x0000000303030100ull,
+    0x0000070707070503ull, 0x000F0F0F0F0F0D0Full, 0x1F1F1F1F1F1F1D1Full, 0x3F3F3F3F3F3F3D3Full,
+    0x0000000404050000ull, 0x0000000000020000ull, 0x0000000101050000ull, 0x00000003030B0100ull,
+    0x0000070707170503ull, 0x000F0F0F0F2F0D0Full, 0x1F1F1F1F1F5F1D1Full, 0x3F3F3F3F3FBF3D3Full,
+    0x0000040407040000ull, 0x0000000007000000ull, 0x0000010107010000ull, 0x000003030F030100ull,
+    0x000007071F070503ull, 0x000F0F0F3F0F0D0Full, 0x1F1F1F1F7F1F1D1Full, 0x3F3F3F3FFFBF3D3Full,
+    0x0004040F0F0F0000ull, 0x0000000F0F0F0000ull, 0x0001010F0F0F0000ull, 0x0003030F0F0F0100ull,
+    0x0007071F1F1F0503ull, 0x000F0F3F3F3F0D0Full, 0x1F1F1F7F7F7F1D1Full, 0x3F3F3FFFFFFF3D3Full,
+    0x04041F1F1F1F1D00ull, 0x00001F1F1F1F1D00ull, 0x01011F1F1F1F1D00ull, 0x03031F1F1F1F1D00ull,
+    0x07071F1F1F1F1D03ull, 0x0F0F3F3F3F3F3D0Full, 0x1F1F7F7F7F7F7D1Full, 0x3F3FFFFFFFFFFD3Full,
+    0xFFFFFFFFFFFFF8FCull, 0xFFFFFFFFFFFFF8F8ull, 0xFFFFFFFFFFFFF1F1ull, 0xFFFFFFFFFFFFE3E3ull,
+    0xFFFFFFFFFFFFC3C7ull, 0xFFFFFFFFFFFF8B8Full, 0xFFFFFFFFFFFF1B1Full, 0xFFFFFFFFFFFF3B3Full,
+    0xFFFFFFFFFFFCF8FCull, 0xFFFFFFFFFFF8F8F8ull, 0x0000000000000000ull, 0xFFFFFFFFFFE3E3E3ull,
+    0xFFFFFFFFFFC7C3C7ull, 0xFFFFFFFFFF8F8B8Full, 0xFFFFFFFFFF1F1B1Full, 0xFFFFFFFFFF3F3B3Full,
+    0x00003F3F3C3C383Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x00003F3F07070307ull, 0x001F7F7F0F0F0B1Full, 0x3F3FFFFF1F1F1B3Full, 0x7F7FFFFF3F3F3B7Full,
+    0x00003E3C3C3C3A3Cull, 0x0000001818181800ull, 0x0000000000000000ull, 0x0000000303030300ull,
+    0x00000F0707070B07ull, 0x001F1F0F0F0F1B1Full, 0x3F3F3F1F1F1F3B3Full, 0x7F7F7F3F3F3F7B7Full,
+    0x00003C3C3C3E3B3Cull, 0x00001818181D1B00ull, 0x00000000000A0A00ull, 0x0000030303171B00ull,
+    0x00000707072F3B07ull, 0x001F0F0F0F5F7B1Full, 0x3F3F1F1F1FBFFB3Full, 0x7F7F3F3F3F7FFB7Full,
+    0x003C3C3C3F3F3A3Cull, 0x001818181F1F1800ull, 0x000000111F1F0000ull, 0x000303031F1F0300ull,
+    0x000707073F3F0B07ull, 0x000F0F0F7F7F1B1Full, 0x3F1F1F1FFFFF3B3Full, 0x7F3F3F3FFFFF7B7Full,
+    0x3C3C3C3F3F3F3B3Cull, 0x1818383F3F3F3B00ull, 0x0000313F3F3F3B00ull, 0x0303233F3F3F3B00ull,
+    0x0707073F3F3F3B07ull, 0x0F0F0F7F7F7F7B1Full, 0x1F1F1FFFFFFFFB3Full, 0x3F3F3FFFFFFFFB7Full,
+    0x3C7C7F7F7F7F7B7Full, 0x18787F7F7F7F7B7Full, 0x00717F7F7F7F7B7Full, 0x03637F7F7F7F7B7Full,
+    0x07477F7F7F7F7B7Full, 0x0F0F7F7F7F7F7B7Full, 0x1F1FFFFFFFFFFBFFull, 0x3F3FFFFFFFFFFBFFull,
+    0xFFFFFFFFFFFFF8FCull, 0x00000000000E0808ull, 0x00000000000E0000ull, 0x00000000000E0202ull,
+    0xFFFFFFFFFFFFC3C7ull, 0xFFFFFFFFFFFF8B8Full, 0xFFFFFFFFFFFF1B1Full, 0xFFFFFFFFFFFF3B3Full,
+    0x00003F3F3F3C383Cull, 0x0000000000080800ull, 0x0000000000000000ull, 0x0000000000020200ull,
+    0x00003F3F3F070307ull, 0x00003F3F3F0F0B07ull, 0x001F7F7F7F1F1B1Full, 0x3F3FFFFFFF3F3B3Full,
+    0x0000001F1C1C1800ull, 0x0000000000080000ull, 0x0000000000000000ull, 0x0000000000020000ull,
+    0x0000001F07070300ull, 0x00000F3F0F0F0B07ull, 0x001F1F7F1F1F1B1Full, 0x3F3F3FFF3F3F3B3Full,
+    0x0000001C1C1C1800ull, 0x0000000008080000ull, 0x0000000000000000ull, 0x0000000002020000ull,
+    0x0000000707070300ull, 0x00000F0F0F0F0B07ull, 0x001F1F1F1F1F1B1Full, 0x3F3F3F3F3F3F3B3Full,
+    0x0000001C1C1D1800ull, 0x00000008080A0000ull, 0x0000000000040000ull, 0x00000002020A0000ull,
+    0x0000000707170300ull, 0x00000F0F0F2F0B07ull, 0x001F1F1F1F5F1B1Full, 0x3F3F3F3F3FBF3B3Full,
+    0x00001C1C1F1C1800ull, 0x000008080E080000ull, 0x000000000E000000ull, 0x000002020E020000ull,
+    0x000007071F070300ull, 0x00000F0F3F0F0B07ull, 0x001F1F1F7F1F1B1Full, 0x3F3F3F3FFF3F3B3Full,
+    0x001C1C1F1F1F1800ull, 0x0008081F1F1F0000ull, 0x0000001F1F1F0000ull, 0x0002021F1F1F0000ull,
+    0x0007071F1F1F0300ull, 0x000F0F3F3F3F0B07ull, 0x001F1F7F7F7F1B1Full, 0x3F3F3FFFFFFF3B3Full,
+    0x1C1C3F3F3F3F3B00ull, 0x08083F3F3F3F3B00ull, 0x00003F3F3F3F3B00ull, 0x02023F3F3F3F3B00ull,
+    0x07073F3F3F3F3B00ull, 0x0F0F3F3F3F3F3B07ull, 0x1F1F7F7F7F7F7B1Full, 0x3F3FFFFFFFFFFB3Full,
+    0xFFFFFFFFFFFFF4FCull, 0xFFFFFFFFFFFFF0F8ull, 0xFFFFFFFFFFFFF1F1ull, 0xFFFFFFFFFFFFE3E3ull,
+    0xFFFFFFFFFFFFC7C7ull, 0xFFFFFFFFFFFF878Full, 0xFFFFFFFFFFFF171Full, 0xFFFFFFFFFFFF373Full,
+    0xFFFFFFFFFFFCF4FCull, 0xFFFFFFFFFFF8F0F8ull, 0xFFFFFFFFFFF1F1F1ull, 0x0000000000000000ull,
+    0xFFFFFFFFFFC7C7C7ull, 0xFFFFFFFFFF8F878Full, 0xFFFFFFFFFF1F171Full, 0xFFFFFFFFFF3F373Full,
+    0x00FEFFFFFCFCF4FEull, 0x00007F7F78787078ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00007F7F0F0F070Full, 0x003FFFFF1F1F173Full, 0x7F7FFFFF3F3F377Full,
+    0x00FEFEFCFCFCF6FEull, 0x00007C7878787478ull, 0x0000003030303000ull, 0x0000000000000000ull,
+    0x0000000606060600ull, 0x00001F0F0F0F170Full, 0x003F3F1F1F1F373Full, 0x7F7F7F3F3F3F777Full,
+    0x00FEFCFCFCFEF7FEull, 0x00007878787D7778ull, 0x00003030303A3600ull, 0x0000000000141400ull,
+    0x00000606062E3600ull, 0x00000F0F0F5F770Full, 0x003F1F1F1FBFF73Full, 0x7F7F3F3F3F7FF77Full,
+    0x00FCFCFCFFFFF6FEull, 0x007878787F7F7478ull, 0x003030303E3E3000ull, 0x000000223E3E0000ull,
+    0x000606063E3E0600ull, 0x000F0F0F7F7F170Full, 0x001F1F1FFFFF373Full, 0x7F3F3F3FFFFF777Full,
+    0xFCFCFCFFFFFFF7FEull, 0x7878787F7F7F7778ull, 0x3030717F7F7F7700ull, 0x0000637F7F7F7700ull,
+    0x0606477F7F7F7700ull, 0x0F0F0F7F7F7F770Full, 0x1F1F1FFFFFFFF73Full, 0x3F3F3FFFFFFFF77Full,
+    0xFCFCFFFFFFFFF7FFull, 0x78F8FFFFFFFFF7FFull, 0x30F1FFFFFFFFF7FFull, 0x00E3FFFFFFFFF7FFull,
+    0x06C7FFFFFFFFF7FFull, 0x0F8FFFFFFFFFF7FFull, 0x1F1FFFFFFFFFF7FFull, 0x3F3FFFFFFFFFF7FFull,
+    0xFFFFFFFFFFFFF4FCull, 0xFFFFFFFFFFFFF0F8ull, 0x00000000001C1010ull, 0x00000000001C0000ull,
+    0x00000000001C0404ull, 0xFFFFFFFFFFFF878Full, 0xFFFFFFFFFFFF171Full, 0xFFFFFFFFFFFF373Full,
+    0x00007F7F7F7C7478ull, 0x00007F7F7F787078ull, 0x0000000000101000ull, 0x0000000000000000ull,
+    0x0000000000040400ull, 0x00007F7F7F0F070Full, 0x00007F7F7F1F170Full, 0x003FFFFFFF3F373Full,
+    0x00007C7F7C7C7478ull, 0x0000003E38383000ull, 0x0000000000100000ull, 0x0000000000000000ull,
+    0x0000000000040000ull, 0x0000003E0E0E0600ull, 0x00001F7F1F1F170Full, 0x003F3FFF3F3F373Full,
+    0x00007C7C7C7C7478ull, 0x0000003838383000ull, 0x0000000010100000ull, 0x0000000000000000ull,
+    0x0000000004040000ull, 0x0000000E0E0E0600ull, 0x00001F1F1F1F170Full, 0x003F3F3F3F3F373Full,
+    0x00007C7C7C7D7478ull, 0x00000038383A3000ull, 0x0000001010140000ull, 0x0000000000080000ull,
+    0x0000000404140000ull, 0x0000000E0E2E0600ull, 0x00001F1F1F5F170Full, 0x003F3F3F3FBF373Full,
+    0x00007C7C7F7C7478ull, 0x000038383E383000ull, 0x000010101C100000ull, 0x000000001C000000ull,
+    0x000004041C040000ull, 0x00000E0E3E0E0600ull, 0x00001F1F7F1F170Full, 0x003F3F3FFF3F373Full,
+    0x007C7C7F7F7F7478ull, 0x0038383E3E3E3000ull, 0x0010103E3E3E0000ull, 0x0000003E3E3E0000ull,
+    0x0004043E3E3E0000ull, 0x000E0E3E3E3E0600ull, 0x001F1F7F7F7F170Full, 0x003F3FFFFFFF373Full,
+    0x7C7C7F7F7F7F7778ull, 0x38387F7F7F7F7700ull, 0x10107F7F7F7F7700ull, 0x00007F7F7F7F7700ull,
+    0x04047F7F7F7F7700ull, 0x0E0E7F7F7F7F7700ull, 0x1F1F7F7F7F7F770Full, 0x3F3FFFFFFFFFF73Full,
+    0xFFFFFFFFFFFEFCFCull, 0xFFFFFFFFFFFEF8F8ull, 0xFFFFFFFFFFFEF1F1ull, 0xFFFFFFFFFFFEE3E3ull,
+    0xFFFFFFFFFFFEC7C7ull, 0xFFFFFFFFFFFE8F8Full, 0xFFFFFFFFFFFE1F1Full, 0xFFFFFFFFFFFE3F3Full,
+    0xFFFFFFFFFFFCFCFCull, 0xFFFFFFFFFFF8F8F8ull, 0xFFFFFFFFFFF0F1F1ull, 0xFFFFFFFFFFE2E3E3ull,
+    0xFFFFFFFFFFC6C7C7ull, 0xFFFFFFFFFF8E8F8Full, 0xFFFFFFFFFF1E1F1Full, 0xFFFFFFFFFF3E3F3Full,
+    0x0000000000000000ull, 0x0000000300000000ull, 0x0000070701000000ull, 0x00070F0F03020300ull,
+    0x0F0F1F1F07060700ull, 0x1F1F3F3F0F0E0F00ull, 0xFFFFFFFF1F1E1FFFull, 0xFFFFFFFF3F3E3FFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0007070303020000ull,
+    0x0F0F0F0707060000ull, 0x1F1F1F0F0F0E0000ull, 0xFFFFFF1F1F1EFFFFull, 0xFFFFFF3F3F3EFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0007030303000000ull,
+    0x0F0F070707000000ull, 0x1F1F0F0F0F000000ull, 0xFFFF1F1F1FFEFFFFull, 0xFFFF3F3F3FFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0003030300000000ull,
+    0x0F07070700000000ull, 0x1F0F0F0F1F000000ull, 0xFF1F1F1FFFFEFFFFull, 0xFF3F3F3FFFFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303030000000000ull,
+    0x0707070F00000000ull, 0x0F0F0F1F1F000000ull, 0x1F1F1FFFFFFEFFFFull, 0x3F3F3FFFFFFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303070000000000ull,
+    0x07070F0F00000000ull, 0x0F0F1F1F1F000000ull, 0x1F1FFFFFFFFEFFFFull, 0x3F3FFFFFFFFEFFFFull,
+    0xFFFFFFFFFFFEFCFCull, 0xFFFFFFFFFFFEF8F8ull, 0xFFFFFFFFFFFEF1F1ull, 0xFFFFFFFFFFFEE3E3ull,
+    0xFFFFFFFFFFFEC7C7ull, 0xFFFFFFFFFFFE8F8Full, 0xFFFFFFFFFFFE1F1Full, 0xFFFFFFFFFFFE3F3Full,
+    0x0000000003000000ull, 0x0000000003000000ull, 0x0000000307000000ull, 0x000007070F020200ull,
+    0x00070F0F1F060700ull, 0x0F0F1F1F3F0E0F00ull, 0x1F1F3F3F7F1E1F00ull, 0xFFFFFFFFFF3E3F3Full,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000200000000ull, 0x0000020602020000ull,
+    0x0007070F07060000ull, 0x0F0F0F1F0F0E0000ull, 0x1F1F1F3F1F1E0000ull, 0xFFFFFFFF3F3E3FFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020202000000ull,
+    0x0007070707000000ull, 0x0F0F0F0F0F000000ull, 0x1F1F1F1F1F000000ull, 0xFFFFFF3F3F3EFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020200000000ull,
+    0x0007070700000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0xFFFF3F3F3FFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull,
+    0x0007070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0xFF3F3F3FFFFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0002000000000000ull,
+    0x0007070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0x3F3F3FFFFFFEFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0707070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1F1F1F000000ull, 0x3F3FFFFFFFFEFFFFull,
+    0xFFFFFFFFFFFDFCFCull, 0xFFFFFFFFFFFDF8F8ull, 0xFFFFFFFFFFFDF1F1ull, 0xFFFFFFFFFFFDE3E3ull,
+    0xFFFFFFFFFFFDC7C7ull, 0xFFFFFFFFFFFD8F8Full, 0xFFFFFFFFFFFD1F1Full, 0xFFFFFFFFFFFD3F3Full,
+    0xFFFFFFFFFFFCFCFCull, 0xFFFFFFFFFFF8F8F8ull, 0xFFFFFFFFFFF1F1F1ull, 0xFFFFFFFFFFE1E3E3ull,
+    0xFFFFFFFFFFC5C7C7ull, 0xFFFFFFFFFF8D8F8Full, 0xFFFFFFFFFF1D1F1Full, 0xFFFFFFFFFF3D3F3Full,
+    0x0000000F0C0C0C00ull, 0x0000000000000000ull, 0x0000000701010100ull, 0x00000F0F03010307ull,
+    0x000F1F1F07050707ull, 0x1F1F3F3F0F0D0F1Full, 0x3F3F7F7F1F1D1F3Full, 0xFFFFFFFF3F3D3FFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000070303010300ull,
+    0x000F0F0707050F07ull, 0x1F1F1F0F0F0D1F1Full, 0x3F3F3F1F1F1D3F3Full, 0xFFFFFF3F3F3DFFFFull,
+    0x00000C0C0C0C0000ull, 0x0000000000000000ull, 0x0000010101010000ull, 0x0007030303050300ull,
+    0x000F0707070D0F07ull, 0x1F1F0F0F0F1D1F1Full, 0x3F3F1F1F1F3D3F3Full, 0xFFFF3F3F3FFDFFFFull,
+    0x000C0C0C0E0D0000ull, 0x0000000005050000ull, 0x000101010B0D0000ull, 0x00030303171D0300ull,
+    0x0F0707072F3D0F07ull, 0x1F0F0F0F5F7D1F1Full, 0x3F1F1F1FBFFD3F3Full, 0xFF3F3F3FFFFDFFFFull,
+    0x0C0C0C0F0F0C0000ull, 0x0000080F0F000000ull, 0x0101010F0F010000ull, 0x0303031F1F050300ull,
+    0x0707073F3F0D0F07ull, 0x0F0F0F7F7F1D1F1Full, 0x1F1F1FFFFF3D3F3Full, 0x3F3F3FFFFFFDFFFFull,
+    0x0C1C1F1F1F1D0000ull, 0x00181F1F1F1D0000ull, 0x01111F1F1F1D0000ull, 0x03031F1F1F1D0300ull,
+    0x07073F3F3F3D0F07ull, 0x0F0F7F7F7F7D1F1Full, 0x1F1FFFFFFFFD3F3Full, 0x3F3FFFFFFFFDFFFFull,
+    0xFFFFFFFFFFFDFCFCull, 0xFFFFFFFFFFFDF8F8ull, 0xFFFFFFFFFFFDF1F1ull, 0xFFFFFFFFFFFDE3E3ull,
+    0xFFFFFFFFFFFDC7C7ull, 0xFFFFFFFFFFFD8F8Full, 0xFFFFFFFFFFFD1F1Full, 0xFFFFFFFFFFFD3F3Full,
+    0x0000000007040400ull, 0x0000000007000000ull, 0x0000000007010100ull, 0x000000070F010300ull,
+    0x00000F0F1F050707ull, 0x000F1F1F3F0D0F07ull, 0x1F1F3F3F7F1D1F1Full, 0x3F3F7F7FFF3D3F3Full,
+    0x0000000004040000ull, 0x0000000000000000ull, 0x0000000001010000ull, 0x0000000703010300ull,
+    0x0000070F07050300ull, 0x000F0F1F0F0D0F07ull, 0x1F1F1F3F1F1D1F1Full, 0x3F3F3F7F3F3D3F3Full,
+    0x0000000004000000ull, 0x0000000000000000ull, 0x0000000001000000ull, 0x0000000303010000ull,
+    0x0000070707050300ull, 0x000F0F0F0F0D0F07ull, 0x1F1F1F1F1F1D1F1Full, 0x3F3F3F3F3F3D3F3Full,
+    0x0000000404000000ull, 0x0000000000000000ull, 0x0000000101000000ull, 0x0000030303010000ull,
+    0x0000070707050300ull, 0x000F0F0F0F0D0F07ull, 0x1F1F1F1F1F1D1F1Full, 0x3F3F3F3F3F3D3F3Full,
+    0x0000040405000000ull, 0x0000000002000000ull, 0x0000010105000000ull, 0x000003030B010000ull,
+    0x0007070717050300ull, 0x000F0F0F2F0D0F07ull, 0x1F1F1F1F5F1D1F1Full, 0x3F3F3F3FBF3D3F3Full,
+    0x0004040704000000ull, 0x0000000700000000ull, 0x0001010701000000ull, 0x0003030F03010000ull,
+    0x0007071F07050300ull, 0x0F0F0F3F0F0D0F07ull, 0x1F1F1F7F1F1D1F1Full, 0x3F3F3FFFBF3D3F3Full,
+    0x04040F0F0F000000ull, 0x00000F0F0F000000ull, 0x01010F0F0F000000ull, 0x03030F0F0F010000ull,
+    0x07071F1F1F050300ull, 0x0F0F3F3F3F0D0F07ull, 0x1F1F7F7F7F1D1F1Full, 0x3F3FFFFFFF3D3F3Full,
+    0xFFFFFFFFFFFBFCFCull, 0xFFFFFFFFFFFBF8F8ull, 0xFFFFFFFFFFFBF1F1ull, 0xFFFFFFFFFFFBE3E3ull,
+    0xFFFFFFFFFFFBC7C7ull, 0xFFFFFFFFFFFB8F8Full, 0xFFFFFFFFFFFB1F1Full, 0xFFFFFFFFFFFB3F3Full,
+    0xFFFFFFFFFFF8FCFCull, 0xFFFFFFFFFFF8F8F8ull, 0xFFFFFFFFFFF1F1F1ull, 0xFFFFFFFFFFE3E3E3ull,
+    0xFFFFFFFFFFC3C7C7ull, 0xFFFFFFFFFF8B8F8Full, 0xFFFFFFFFFF1B1F1Full, 0xFFFFFFFFFF3B3F3Full,
+    0x00003F3F3C383C3Eull, 0x0000001E18181800ull, 0x0000000000000000ull, 0x0000000F03030300ull,
+    0x00001F1F0703070Full, 0x001F3F3F0F0B0F0Full, 0x3F3F7F7F1F1B1F3Full, 0x7F7FFFFF3F3B3F7Full,
+    0x00003E3C3C383C00ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x00000F0707030700ull, 0x001F1F0F0F0B1F0Full, 0x3F3F3F1F1F1B3F3Full, 0x7F7F7F3F3F3B7F7Full,
+    0x003E3C3C3C3A3C00ull, 0x0000181818180000ull, 0x0000000000000000ull, 0x0000030303030000ull,
+    0x000F0707070B0700ull, 0x001F0F0F0F1B1F0Full, 0x3F3F1F1F1F3B3F3Full, 0x7F7F3F3F3F7B7F7Full,
+    0x003C3C3C3E3B3C00ull, 0x001818181D1B0000ull, 0x000000000A0A0000ull, 0x00030303171B0000ull,
+    0x000707072F3B0700ull, 0x1F0F0F0F5F7B1F0Full, 0x3F1F1F1FBFFB3F3Full, 0x7F3F3F3F7FFB7F7Full,
+    0x3C3C3C3F3F3A3C00ull, 0x1818181F1F180000ull, 0x0000111F1F000000ull, 0x0303031F1F030000ull,
+    0x0707073F3F0B0700ull, 0x0F0F0F7F7F1B1F0Full, 0x1F1F1FFFFF3B3F3Full, 0x3F3F3FFFFF7B7F7Full,
+    0x3C3C3F3F3F3B3C00ull, 0x18383F3F3F3B0000ull, 0x00313F3F3F3B0000ull, 0x03233F3F3F3B0000ull,
+    0x07073F3F3F3B0700ull, 0x0F0F7F7F7F7B1F0Full, 0x1F1FFFFFFFFB3F3Full, 0x3F3FFFFFFFFB7F7Full,
+    0xFFFFFFFFFFFBFCFCull, 0xFFFFFFFFFFFBF8F8ull, 0xFFFFFFFFFFFBF1F1ull, 0xFFFFFFFFFFFBE3E3ull,
+    0xFFFFFFFFFFFBC7C7ull, 0xFFFFFFFFFFFB8F8Full, 0xFFFFFFFFFFFB1F1Full, 0xFFFFFFFFFFFB3F3Full,
+    0x0000001E1F181C00ull, 0x000000000E080800ull, 0x000000000E000000ull, 0x000000000E020200ull,
+    0x0000000F1F030700ull, 0x00001F1F3F0B0F0Full, 0x001F3F3F7F1B1F0Full, 0x3F3F7F7FFF3B3F3Full,
+    0x0000001E1C181C00ull, 0x0000000008080000ull, 0x0000000000000000ull, 0x0000000002020000ull,
+    0x0000000F07030700ull, 0x00000F1F0F0B0700ull, 0x001F1F3F1F1B1F0Full, 0x3F3F3F7F3F3B3F3Full,
+    0x0000001C1C180000ull, 0x0000000008000000ull, 0x0000000000000000ull, 0x0000000002000000ull,
+    0x0000000707030000ull, 0x00000F0F0F0B0700ull, 0x001F1F1F1F1B1F0Full, 0x3F3F3F3F3F3B3F3Full,
+    0x00001C1C1C180000ull, 0x0000000808000000ull, 0x0000000000000000ull, 0x0000000202000000ull,
+    0x0000070707030000ull, 0x00000F0F0F0B0700ull, 0x001F1F1F1F1B1F0Full, 0x3F3F3F3F3F3B3F3Full,
+    0x00001C1C1D180000ull, 0x000008080A000000ull, 0x0000000004000000ull, 0x000002020A000000ull,
+    0x0000070717030000ull, 0x000F0F0F2F0B0700ull, 0x001F1F1F5F1B1F0Full, 0x3F3F3F3FBF3B3F3Full,
+    0x001C1C1F1C180000ull, 0x0008080E08000000ull, 0x0000000E00000000ull, 0x0002020E02000000ull,
+    0x0007071F07030000ull, 0x000F0F3F0F0B0700ull, 0x1F1F1F7F1F1B1F0Full, 0x3F3F3FFF3F3B3F3Full,
+    0x1C1C1F1F1F180000ull, 0x08081F1F1F000000ull, 0x00001F1F1F000000ull, 0x02021F1F1F000000ull,
+    0x07071F1F1F030000ull, 0x0F0F3F3F3F0B0700ull, 0x1F1F7F7F7F1B1F0Full, 0x3F3FFFFFFF3B3F3Full,
+    0xFFFFFFFFFFF7FCFCull, 0xFFFFFFFFFFF7F8F8ull, 0xFFFFFFFFFFF7F1F1ull, 0xFFFFFFFFFFF7E3E3ull,
+    0xFFFFFFFFFFF7C7C7ull, 0xFFFFFFFFFFF78F8Full, 0xFFFFFFFFFFF71F1Full, 0xFFFFFFFFFFF73F3Full,
+    0xFFFFFFFFFFF4FCFCull, 0xFFFFFFFFFFF0F8F8ull, 0xFFFFFFFFFFF1F1F1ull, 0xFFFFFFFFFFE3E3E3ull,
+    0xFFFFFFFFFFC7C7C7ull, 0xFFFFFFFFFF878F8Full, 0xFFFFFFFFFF171F1Full, 0xFFFFFFFFFF373F3Full,
+    0x00FEFFFFFCF4FCFCull, 0x00007E7E7870787Cull, 0x0000003C30303000ull, 0x0000000000000000ull,
+    0x0000001E06060600ull, 0x00003F3F0F070F1Full, 0x003F7F7F1F171F1Full, 0x7F7FFFFF3F373F7Full,
+    0x00FEFEFCFCF4FEFCull, 0x00007C7878707800ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00001F0F0F070F00ull, 0x003F3F1F1F173F1Full, 0x7F7F7F3F3F377F7Full,
+    0x00FEFCFCFCF6FEFCull, 0x007C787878747800ull, 0x0000303030300000ull, 0x0000000000000000ull,
+    0x0000060606060000ull, 0x001F0F0F0F170F00ull, 0x003F1F1F1F373F1Full, 0x7F7F3F3F3F777F7Full,
+    0xFEFCFCFCFEF7FEFCull, 0x007878787D777800ull, 0x003030303A360000ull, 0x0000000014140000ull,
+    0x000606062E360000ull, 0x000F0F0F5F770F00ull, 0x3F1F1F1FBFF73F1Full, 0x7F3F3F3F7FF77F7Full,
+    0xFCFCFCFFFFF6FEFCull, 0x7878787F7F747800ull, 0x3030303E3E300000ull, 0x0000223E3E000000ull,
+    0x0606063E3E060000ull, 0x0F0F0F7F7F170F00ull, 0x1F1F1FFFFF373F1Full, 0x3F3F3FFFFF777F7Full,
+    0xFCFCFFFFFFF7FEFCull, 0x78787F7F7F777800ull, 0x30717F7F7F770000ull, 0x00637F7F7F770000ull,
+    0x06477F7F7F770000ull, 0x0F0F7F7F7F770F00ull, 0x1F1FFFFFFFF73F1Full, 0x3F3FFFFFFFF77F7Full,
+    0xFFFFFFFFFFF7FCFCull, 0xFFFFFFFFFFF7F8F8ull, 0xFFFFFFFFFFF7F1F1ull, 0xFFFFFFFFFFF7E3E3ull,
+    0xFFFFFFFFFFF7C7C7ull, 0xFFFFFFFFFFF78F8Full, 0xFFFFFFFFFFF71F1Full, 0xFFFFFFFFFFF73F3Full,
+    0x00007E7E7F747C7Cull, 0x0000003C3E303800ull, 0x000000001C101000ull, 0x000000001C000000ull,
+    0x000000001C040400ull, 0x0000001E3E060E00ull, 0x00003F3F7F171F1Full, 0x003F7F7FFF373F1Full,
+    0x00007C7E7C747800ull, 0x0000003C38303800ull, 0x0000000010100000ull, 0x0000000000000000ull,
+    0x0000000004040000ull, 0x0000001E0E060E00ull, 0x00001F3F1F170F00ull, 0x003F3F7F3F373F1Full,
+    0x00007C7C7C747800ull, 0x0000003838300000ull, 0x0000000010000000ull, 0x0000000000000000ull,
+    0x0000000004000000ull, 0x0000000E0E060000ull, 0x00001F1F1F170F00ull, 0x003F3F3F3F373F1Full,
+    0x00007C7C7C747800ull, 0x0000383838300000ull, 0x0000001010000000ull, 0x0000000000000000ull,
+    0x0000000404000000ull, 0x00000E0E0E060000ull, 0x00001F1F1F170F00ull, 0x003F3F3F3F373F1Full,
+    0x007C7C7C7D747800ull, 0x000038383A300000ull, 0x0000101014000000ull, 0x0000000008000000ull,
+    0x0000040414000000ull, 0x00000E0E2E060000ull, 0x001F1F1F5F170F00ull, 0x003F3F3FBF373F1Full,
+    0x007C7C7F7C747800ull, 0x0038383E38300000ull, 0x0010101C10000000ull, 0x0000001C00000000ull,
+    0x0004041C04000000ull, 0x000E0E3E0E060000ull, 0x001F1F7F1F170F00ull, 0x3F3F3FFF3F373F1Full,
+    0x7C7C7F7F7F747800ull, 0x38383E3E3E300000ull, 0x10103E3E3E000000ull, 0x00003E3E3E000000ull,
+    0x04043E3E3E000000ull, 0x0E0E3E3E3E060000ull, 0x1F1F7F7F7F170F00ull, 0x3F3FFFFFFF373F1Full,
+    0xFFFFFFFFFEFFFCFCull, 0xFFFFFFFFFEFFF8F8ull, 0xFFFFFFFFFEFFF1F1ull, 0xFFFFFFFFFEFFE3E3ull,
+    0xFFFFFFFFFEFFC7C7ull, 0xFFFFFFFFFEFF8F8Full, 0xFFFFFFFFFEFF1F1Full, 0xFFFFFFFFFEFF3F3Full,
+    0xFFFFFFFFFEFCFCFCull, 0xFFFFFFFFFEF8F8F8ull, 0xFFFFFFFFFEF1F1F1ull, 0xFFFFFFFFFEE3E3E3ull,
+    0xFFFFFFFFFEC7C7C7ull, 0xFFFFFFFFFE8F8F8Full, 0xFFFFFFFFFE1F1F1Full, 0xFFFFFFFFFE3F3F3Full,
+    0xFFFFFFFFFCFCFCFFull, 0xFFFFFFFFF8F8F8FFull, 0xFFFFFFFFF0F1F1FFull, 0xFFFFFFFFE2E3E3FFull,
+    0xFFFFFFFFC6C7C7FFull, 0xFFFFFFFF8E8F8FFFull, 0xFFFFFFFF1E1F1FFFull, 0xFFFFFFFF3E3F3FFFull,
+    0x0000000000000000ull, 0x0000030000000000ull, 0x0007070100000000ull, 0x070F0F0302030000ull,
+    0x0F1F1F0706070000ull, 0xFFFFFF8F8E8FFFFFull, 0xFFFFFF1F1E1FFFFFull, 0xFFFFFF3F3E3FFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0002000000000000ull, 0x0707030302000000ull,
+    0x0F0F070706000000ull, 0xFFFF8F8F8EFFFFFFull, 0xFFFF1F1F1EFFFFFFull, 0xFFFF3F3F3EFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0703030300000000ull,
+    0x0F07070700000000ull, 0xFF8F8F8FFEFFFFFFull, 0xFF1F1F1FFEFFFFFFull, 0xFF3F3F3FFEFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303030000000000ull,
+    0x0707070F00000000ull, 0x8F8F8FFFFEFFFFFFull, 0x1F1F1FFFFEFFFFFFull, 0x3F3F3FFFFEFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303070000000000ull,
+    0x07070F0F00000000ull, 0x8F8FFFFFFEFFFFFFull, 0x1F1FFFFFFEFFFFFFull, 0x3F3FFFFFFEFFFFFFull,
+    0xFFFFFFFFFEFFFCFCull, 0xFFFFFFFFFEFFF8F8ull, 0xFFFFFFFFFEFFF1F1ull, 0xFFFFFFFFFEFFE3E3ull,
+    0xFFFFFFFFFEFFC7C7ull, 0xFFFFFFFFFEFF8F8Full, 0xFFFFFFFFFEFF1F1Full, 0xFFFFFFFFFEFF3F3Full,
+    0xFFFFFFFFFEFCFCFCull, 0xFFFFFFFFFEF8F8F8ull, 0xFFFFFFFFFEF1F1F1ull, 0xFFFFFFFFFEE3E3E3ull,
+    0xFFFFFFFFFEC7C7C7ull, 0xFFFFFFFFFE8F8F8Full, 0xFFFFFFFFFE1F1F1Full, 0xFFFFFFFFFE3F3F3Full,
+    0x0000000300000000ull, 0x0000000300000000ull, 0x0000030700000000ull, 0x0007070F02020000ull,
+    0x070F0F1F06070000ull, 0x0F1F1F3F0E0F0000ull, 0xFFFFFFFF1E1F1FFFull, 0xFFFFFFFF3E3F3FFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0002060202000000ull,
+    0x07070F0706000000ull, 0x0F0F1F0F0E000000ull, 0xFFFFFF1F1E1FFFFFull, 0xFFFFFF3F3E3FFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0002020200000000ull,
+    0x0707070700000000ull, 0x0F0F0F0F00000000ull, 0xFFFF1F1F1EFFFFFFull, 0xFFFF3F3F3EFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0002020000000000ull,
+    0x0707070000000000ull, 0x0F0F0F0F00000000ull, 0xFF1F1F1FFEFFFFFFull, 0xFF3F3F3FFEFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0002000000000000ull,
+    0x0707070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1F1FFFFEFFFFFFull, 0x3F3F3FFFFEFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0707070000000000ull, 0x0F0F0F0F00000000ull, 0x1F1FFFFFFEFFFFFFull, 0x3F3FFFFFFEFFFFFFull,
+    0xFFFFFFFFFDFFFCFCull, 0xFFFFFFFFFDFFF8F8ull, 0xFFFFFFFFFDFFF1F1ull, 0xFFFFFFFFFDFFE3E3ull,
+    0xFFFFFFFFFDFFC7C7ull, 0xFFFFFFFFFDFF8F8Full, 0xFFFFFFFFFDFF1F1Full, 0xFFFFFFFFFDFF3F3Full,
+    0xFFFFFFFFFDFCFCFCull, 0xFFFFFFFFFDF8F8F8ull, 0xFFFFFFFFFDF1F1F1ull, 0xFFFFFFFFFDE3E3E3ull,
+    0xFFFFFFFFFDC7C7C7ull, 0xFFFFFFFFFD8F8F8Full, 0xFFFFFFFFFD1F1F1Full, 0xFFFFFFFFFD3F3F3Full,
+    0xFFFFFFFFFCFCFCFFull, 0xFFFFFFFFF8F8F8FFull, 0xFFFFFFFFF1F1F1FFull, 0xFFFFFFFFE1E3E3FFull,
+    0xFFFFFFFFC5C7C7FFull, 0xFFFFFFFF8D8F8FFFull, 0xFFFFFFFF1D1F1FFFull, 0xFFFFFFFF3D3F3FFFull,
+    0x00000F0C0C0C0000ull, 0x0000000000000000ull, 0x0000070101010000ull, 0x000F0F0301030700ull,
+    0x0F1F1F0705070700ull, 0x1F3F3F0F0D0F1F0Full, 0xFFFFFF1F1D1FFFFFull, 0xFFFFFF3F3D3FFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0007030301030000ull,
+    0x0F0F0707050F0700ull, 0x1F1F0F0F0D1F1F0Full, 0xFFFF1F1F1DFFFFFFull, 0xFFFF3F3F3DFFFFFFull,
+    0x000C0C0C0C000000ull, 0x0000000000000000ull, 0x0001010101000000ull, 0x0703030305030000ull,
+    0x0F0707070D0F0700ull, 0x1F0F0F0F1D1F1F0Full, 0xFF1F1F1FFDFFFFFFull, 0xFF3F3F3FFDFFFFFFull,
+    0x0C0C0C0E0D000000ull, 0x0000000505000000ull, 0x0101010B0D000000ull, 0x030303171D030000ull,
+    0x0707072F3D0F0700ull, 0x0F0F0F5F7D1F1F0Full, 0x1F1F1FFFFDFFFFFFull, 0x3F3F3FFFFDFFFFFFull,
+    0x0C0C0F0F0C000000ull, 0x00080F0F00000000ull, 0x01010F0F01000000ull, 0x03031F1F05030000ull,
+    0x07073F3F0D0F0700ull, 0x0F0F7F7F1D1F1F0Full, 0x1F1FFFFFFDFFFFFFull, 0x3F3FFFFFFDFFFFFFull,
+    0xFFFFFFFFFDFFFCFCull, 0xFFFFFFFFFDFFF8F8ull, 0xFFFFFFFFFDFFF1F1ull, 0xFFFFFFFFFDFFE3E3ull,
+    0xFFFFFFFFFDFFC7C7ull, 0xFFFFFFFFFDFF8F8Full, 0xFFFFFFFFFDFF1F1Full, 0xFFFFFFFFFDFF3F3Full,
+    0xFFFFFFFFFDFCFCFCull, 0xFFFFFFFFFDF8F8F8ull, 0xFFFFFFFFFDF1F1F1ull, 0xFFFFFFFFFDE3E3E3ull,
+    0xFFFFFFFFFDC7C7C7ull, 0xFFFFFFFFFD8F8F8Full, 0xFFFFFFFFFD1F1F1Full, 0xFFFFFFFFFD3F3F3Full,
+    0x0000000704040000ull, 0x0000000700000000ull, 0x0000000701010000ull, 0x0000070F01030000ull,
+    0x000F0F1F05070700ull, 0x0F1F1F3F0D0F0700ull, 0x1F3F3F7F1D1F1F0Full, 0xFFFFFFFF3D3F3FFFull,
+    0x0000000404000000ull, 0x0000000000000000ull, 0x0000000101000000ull, 0x0000070301030000ull,
+    0x00070F0705030000ull, 0x0F0F1F0F0D0F0700ull, 0x1F1F3F1F1D1F1F0Full, 0xFFFFFF3F3D3FFFFFull,
+    0x0000000400000000ull, 0x0000000000000000ull, 0x0000000100000000ull, 0x0000030301000000ull,
+    0x0007070705030000ull, 0x0F0F0F0F0D0F0700ull, 0x1F1F1F1F1D1F1F0Full, 0xFFFF3F3F3DFFFFFFull,
+    0x0000040400000000ull, 0x0000000000000000ull, 0x0000010100000000ull, 0x0003030301000000ull,
+    0x0007070705030000ull, 0x0F0F0F0F0D0F0700ull, 0x1F1F1F1F1D1F1F0Full, 0xFF3F3F3FFDFFFFFFull,
+    0x0004040500000000ull, 0x0000000200000000ull, 0x0001010500000000ull, 0x0003030B01000000ull,
+    0x0707071705030000ull, 0x0F0F0F2F0D0F0700ull, 0x1F1F1F5F1D1F1F0Full, 0x3F3F3FFFFDFFFFFFull,
+    0x0404070400000000ull, 0x0000070000000000ull, 0x0101070100000000ull, 0x03030F0301000000ull,
+    0x07071F0705030000ull, 0x0F0F3F0F0D0F0700ull, 0x1F1F7F5F1D1F1F0Full, 0x3F3FFFFFFDFFFFFFull,
+    0xFFFFFFFFFBFFFCFCull, 0xFFFFFFFFFBFFF8F8ull, 0xFFFFFFFFFBFFF1F1ull, 0xFFFFFFFFFBFFE3E3ull,
+    0xFFFFFFFFFBFFC7C7ull, 0xFFFFFFFFFBFF8F8Full, 0xFFFFFFFFFBFF1F1Full, 0xFFFFFFFFFBFF3F3Full,
+    0xFFFFFFFFFBFCFCFCull, 0xFFFFFFFFFBF8F8F8ull, 0xFFFFFFFFFBF1F1F1ull, 0xFFFFFFFFFBE3E3E3ull,
+    0xFFFFFFFFFBC7C7C7ull, 0xFFFFFFFFFB8F8F8Full, 0xFFFFFFFFFB1F1F1Full, 0xFFFFFFFFFB3F3F3Full,
+    0xFFFFFFFFF8FCFCFFull, 0xFFFFFFFFF8F8F8FFull, 0xFFFFFFFFF1F1F1FFull, 0xFFFFFFFFE3E3E3FFull,
+    0xFFFFFFFFC3C7C7FFull, 0xFFFFFFFF8B8F8FFFull, 0xFFFFFFFF1B1F1FFFull, 0xFFFFFFFF3B3F3FFFull,
+    0x003F3F3C383C3E00ull, 0x00001E1818180000ull, 0x0000000000000000ull, 0x00000F0303030000ull,
+    0x001F1F0703070F00ull, 0x1F3F3F0F0B0F0F00ull, 0x3F7F7F1F1B1F3F1Full, 0xFFFFFF3F3B3FFFFFull,
+    0x003E3C3C383C0000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x000F070703070000ull, 0x1F1F0F0F0B1F0F00ull, 0x3F3F1F1F1B3F3F1Full, 0xFFFF3F3F3BFFFFFFull,
+    0x3E3C3C3C3A3C0000ull, 0x0018181818000000ull, 0x0000000000000000ull, 0x0003030303000000ull,
+    0x0F0707070B070000ull, 0x1F0F0F0F1B1F0F00ull, 0x3F1F1F1F3B3F3F1Full, 0xFF3F3F3FFBFFFFFFull,
+    0x3C3C3C3E3B3C0000ull, 0x1818181D1B000000ull, 0x0000000A0A000000ull, 0x030303171B000000ull,
+    0x0707072F3B070000ull, 0x0F0F0F5F7B1F0F00ull, 0x1F1F1FBFFB3F3F1Full, 0x3F3F3FFFFBFFFFFFull,
+    0x3C3C3F3F3A3C0000ull, 0x18181F1F18000000ull, 0x00111F1F00000000ull, 0x03031F1F03000000ull,
+    0x07073F3F0B070000ull, 0x0F0F7F7F1B1F0F00ull, 0x1F1FFFFF3B3F3F1Full, 0x3F3FFFFFFBFFFFFFull,
+    0xFFFFFFFFFBFFFCFCull, 0xFFFFFFFFFBFFF8F8ull, 0xFFFFFFFFFBFFF1F1ull, 0xFFFFFFFFFBFFE3E3ull,
+    0xFFFFFFFFFBFFC7C7ull, 0xFFFFFFFFFBFF8F8Full, 0xFFFFFFFFFBFF1F1Full, 0xFFFFFFFFFBFF3F3Full,
+    0xFFFFFFFFFBFCFCFCull, 0xFFFFFFFFFBF8F8F8ull, 0xFFFFFFFFFBF1F1F1ull, 0xFFFFFFFFFBE3E3E3ull,
+    0xFFFFFFFFFBC7C7C7ull, 0xFFFFFFFFFB8F8F8Full, 0xFFFFFFFFFB1F1F1Full, 0xFFFFFFFFFB3F3F3Full,
+    0x00001E1F181C0000ull, 0x0000000E08080000ull, 0x0000000E00000000ull, 0x0000000E02020000ull,
+    0x00000F1F03070000ull, 0x001F1F3F0B0F0F00ull, 0x1F3F3F7F1B1F0F00ull, 0x3F7F7FFF3B3F3F1Full,
+    0x00001E1C181C0000ull, 0x0000000808000000ull, 0x0000000000000000ull, 0x0000000202000000ull,
+    0x00000F0703070000ull, 0x000F1F0F0B070000ull, 0x1F1F3F1F1B1F0F00ull, 0x3F3F7F3F3B3F3F1Full,
+    0x00001C1C18000000ull, 0x0000000800000000ull, 0x0000000000000000ull, 0x0000000200000000ull,
+    0x0000070703000000ull, 0x000F0F0F0B070000ull, 0x1F1F1F1F1B1F0F00ull, 0x3F3F3F3F3B3F3F1Full,
+    0x001C1C1C18000000ull, 0x0000080800000000ull, 0x0000000000000000ull, 0x0000020200000000ull,
+    0x0007070703000000ull, 0x000F0F0F0B070000ull, 0x1F1F1F1F1B1F0F00ull, 0x3F3F3F3F3B3F3F1Full,
+    0x001C1C1D18000000ull, 0x0008080A00000000ull, 0x0000000400000000ull, 0x0002020A00000000ull,
+    0x0007071703000000ull, 0x0F0F0F2F0B070000ull, 0x1F1F1F5F1B1F0F00ull, 0x3F3F3FBF3B3F3F1Full,
+    0x1C1C1F1C18000000ull, 0x08080E0800000000ull, 0x00000E0000000000ull, 0x02020E0200000000ull,
+    0x07071F0703000000ull, 0x0F0F3F0F0B070000ull, 0x1F1F7F1F1B1F0F00ull, 0x3F3FFFBF3B3F3F1Full,
+    0xFFFFFFFFF7FFFCFCull, 0xFFFFFFFFF7FFF8F8ull, 0xFFFFFFFFF7FFF1F1ull, 0xFFFFFFFFF7FFE3E3ull,
+    0xFFFFFFFFF7FFC7C7ull, 0xFFFFFFFFF7FF8F8Full, 0xFFFFFFFFF7FF1F1Full, 0xFFFFFFFFF7FF3F3Full,
+    0xFFFFFFFFF7FCFCFCull, 0xFFFFFFFFF7F8F8F8ull, 0xFFFFFFFFF7F1F1F1ull, 0xFFFFFFFFF7E3E3E3ull,
+    0xFFFFFFFFF7C7C7C7ull, 0xFFFFFFFFF78F8F8Full, 0xFFFFFFFFF71F1F1Full, 0xFFFFFFFFF73F3F3Full,
+    0xFFFFFFFFF4FCFCFFull, 0xFFFFFFFFF0F8F8FFull, 0xFFFFFFFFF1F1F1FFull, 0xFFFFFFFFE3E3E3FFull,
+    0xFFFFFFFFC7C7C7FFull, 0xFFFFFFFF878F8FFFull, 0xFFFFFFFF171F1FFFull, 0xFFFFFFFF373F3FFFull,
+    0xFEFFFFFCF4FCFC00ull, 0x007E7E7870787C00ull, 0x00003C3030300000ull, 0x0000000000000000ull,
+    0x00001E0606060000ull, 0x003F3F0F070F1F00ull, 0x3F7F7F1F171F1F00ull, 0x7FFFFF3F373F7F3Full,
+    0xFEFEFCFCF4FEFC00ull, 0x007C787870780000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x001F0F0F070F0000ull, 0x3F3F1F1F173F1F00ull, 0x7F7F3F3F377F7F3Full,
+    0xFEFCFCFCF6FEFC00ull, 0x7C78787874780000ull, 0x0030303030000000ull, 0x0000000000000000ull,
+    0x0006060606000000ull, 0x1F0F0F0F170F0000ull, 0x3F1F1F1F373F1F00ull, 0x7F3F3F3F777F7F3Full,
+    0xFCFCFCFEF7FEFC00ull, 0x7878787D77780000ull, 0x3030303A36000000ull, 0x0000001414000000ull,
+    0x0606062E36000000ull, 0x0F0F0F5F770F0000ull, 0x1F1F1FBFF73F1F00ull, 0x3F3F3F7FF77F7F3Full,
+    0xFCFCFFFFF6FEFC00ull, 0x78787F7F74780000ull, 0x30303E3E30000000ull, 0x00223E3E00000000ull,
+    0x06063E3E06000000ull, 0x0F0F7F7F170F0000ull, 0x1F1FFFFF373F1F00ull, 0x3F3FFFFF777F7F3Full,
+    0xFFFFFFFFF7FFFCFCull, 0xFFFFFFFFF7FFF8F8ull, 0xFFFFFFFFF7FFF1F1ull, 0xFFFFFFFFF7FFE3E3ull,
+    0xFFFFFFFFF7FFC7C7ull, 0xFFFFFFFFF7FF8F8Full, 0xFFFFFFFFF7FF1F1Full, 0xFFFFFFFFF7FF3F3Full,
+    0xFFFFFFFFF7FCFCFCull, 0xFFFFFFFFF7F8F8F8ull, 0xFFFFFFFFF7F1F1F1ull, 0xFFFFFFFFF7E3E3E3ull,
+    0xFFFFFFFFF7C7C7C7ull, 0xFFFFFFFFF78F8F8Full, 0xFFFFFFFFF71F1F1Full, 0xFFFFFFFFF73F3F3Full,
+    0x007E7E7F747C7C00ull, 0x00003C3E30380000ull, 0x0000001C10100000ull, 0x0000001C00000000ull,
+    0x0000001C04040000ull, 0x00001E3E060E0000ull, 0x003F3F7F171F1F00ull, 0x3F7F7FFF373F1F00ull,
+    0x007C7E7C74780000ull, 0x00003C3830380000ull, 0x0000001010000000ull, 0x0000000000000000ull,
+    0x0000000404000000ull, 0x00001E0E060E0000ull, 0x001F3F1F170F0000ull, 0x3F3F7F3F373F1F00ull,
+    0x007C7C7C74780000ull, 0x0000383830000000ull, 0x0000001000000000ull, 0x0000000000000000ull,
+    0x0000000400000000ull, 0x00000E0E06000000ull, 0x001F1F1F170F0000ull, 0x3F3F3F3F373F1F00ull,
+    0x007C7C7C74780000ull, 0x0038383830000000ull, 0x0000101000000000ull, 0x0000000000000000ull,
+    0x0000040400000000ull, 0x000E0E0E06000000ull, 0x001F1F1F170F0000ull, 0x3F3F3F3F373F1F00ull,
+    0x7C7C7C7D74780000ull, 0x0038383A30000000ull, 0x0010101400000000ull, 0x0000000800000000ull,
+    0x0004041400000000ull, 0x000E0E2E06000000ull, 0x1F1F1F5F170F0000ull, 0x3F3F3FBF373F1F00ull,
+    0x7C7C7F7C74780000ull, 0x38383E3830000000ull, 0x10101C1000000000ull, 0x00001C0000000000ull,
+    0x04041C0400000000ull, 0x0E0E3E0E06000000ull, 0x1F1F7F1F170F0000ull, 0x3F3FFF3F373F1F00ull,
+    0xFFFFFFFEFFFFFCFCull, 0xFFFFFFFEFFFFF8F8ull, 0xFFFFFFFEFFFFF1F1ull, 0xFFFFFFFEFFFFE3E3ull,
+    0xFFFFFFFEFFFFC7C7ull, 0xFFFFFFFEFFFF8F8Full, 0xFFFFFFFEFFFF1F1Full, 0xFFFFFFFEFFFF3F3Full,
+    0xFFFFFFFEFFFCFCFCull, 0xFFFFFFFEFFF8F8F8ull, 0xFFFFFFFEFFF1F1F1ull, 0xFFFFFFFEFFE3E3E3ull,
+    0xFFFFFFFEFFC7C7C7ull, 0xFFFFFFFEFF8F8F8Full, 0xFFFFFFFEFF1F1F1Full, 0xFFFFFFFEFF3F3F3Full,
+    0xFFFFFFFEFCFCFCFFull, 0xFFFFFFFEF8F8F8FFull, 0xFFFFFFFEF1F1F1FFull, 0xFFFFFFFEE3E3E3FFull,
+    0xFFFFFFFEC7C7C7FFull, 0xFFFFFFFE8F8F8FFFull, 0xFFFFFFFE1F1F1FFFull, 0xFFFFFFFE3F3F3FFFull,
+    0xFFFFFFFCFCFCFFFFull, 0xFFFFFFF8F8F8FFFFull, 0xFFFFFFF0F1F1FFFFull, 0xFFFFFFE2E3E3FFFFull,
+    0xFFFFFFC6C7C7FFFFull, 0xFFFFFF8E8F8FFFFFull, 0xFFFFFF1E1F1FFFFFull, 0xFFFFFF3E3F3FFFFFull,
+    0x0000000000000000ull, 0x0003000000000000ull, 0x0707010000000000ull, 0x0F0F030203000000ull,
+    0xFFFFC7C6C7FFFFFFull, 0xFFFF8F8E8FFFFFFFull, 0xFFFF1F1E1FFFFFFFull, 0xFFFF3F3E3FFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0200000000000000ull, 0x0703030200000000ull,
+    0xFFC7C7C6FFFFFFFFull, 0xFF8F8F8EFFFFFFFFull, 0xFF1F1F1EFFFFFFFFull, 0xFF3F3F3EFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303030000000000ull,
+    0xC7C7C7FEFFFFFFFFull, 0x8F8F8FFEFFFFFFFFull, 0x1F1F1FFEFFFFFFFFull, 0x3F3F3FFEFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303070000000000ull,
+    0xC7C7FFFEFFFFFFFFull, 0x8F8FFFFEFFFFFFFFull, 0x1F1FFFFEFFFFFFFFull, 0x3F3FFFFEFFFFFFFFull,
+    0xFFFFFFFEFFFFFCFCull, 0xFFFFFFFEFFFFF8F8ull, 0xFFFFFFFEFFFFF1F1ull, 0xFFFFFFFEFFFFE3E3ull,
+    0xFFFFFFFEFFFFC7C7ull, 0xFFFFFFFEFFFF8F8Full, 0xFFFFFFFEFFFF1F1Full, 0xFFFFFFFEFFFF3F3Full,
+    0xFFFFFFFEFFFCFCFCull, 0xFFFFFFFEFFF8F8F8ull, 0xFFFFFFFEFFF1F1F1ull, 0xFFFFFFFEFFE3E3E3ull,
+    0xFFFFFFFEFFC7C7C7ull, 0xFFFFFFFEFF8F8F8Full, 0xFFFFFFFEFF1F1F1Full, 0xFFFFFFFEFF3F3F3Full,
+    0xFFFFFFFEFCFCFCFFull, 0xFFFFFFFEF8F8F8FFull, 0xFFFFFFFEF1F1F1FFull, 0xFFFFFFFEE3E3E3FFull,
+    0xFFFFFFFEC7C7C7FFull, 0xFFFFFFFE8F8F8FFFull, 0xFFFFFFFE1F1F1FFFull, 0xFFFFFFFE3F3F3FFFull,
+    0x0000030000000000ull, 0x0000030000000000ull, 0x0003070000000000ull, 0x07070F0202000000ull,
+    0x0F0F1F0607000000ull, 0xFFFFFF8E8F8FFFFFull, 0xFFFFFF1E1F1FFFFFull, 0xFFFFFF3E3F3FFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0002000000000000ull, 0x0206020200000000ull,
+    0x070F070600000000ull, 0xFFFF8F8E8FFFFFFFull, 0xFFFF1F1E1FFFFFFFull, 0xFFFF3F3E3FFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202020000000000ull,
+    0x0707070000000000ull, 0xFF8F8F8EFFFFFFFFull, 0xFF1F1F1EFFFFFFFFull, 0xFF3F3F3EFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0707070000000000ull, 0x8F8F8FFEFFFFFFFFull, 0x1F1F1FFEFFFFFFFFull, 0x3F3F3FFEFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0707070000000000ull, 0x8F8FFFFEFFFFFFFFull, 0x1F1FFFFEFFFFFFFFull, 0x3F3FFFFEFFFFFFFFull,
+    0xFFFFFFFDFFFFFCFCull, 0xFFFFFFFDFFFFF8F8ull, 0xFFFFFFFDFFFFF1F1ull, 0xFFFFFFFDFFFFE3E3ull,
+    0xFFFFFFFDFFFFC7C7ull, 0xFFFFFFFDFFFF8F8Full, 0xFFFFFFFDFFFF1F1Full, 0xFFFFFFFDFFFF3F3Full,
+    0xFFFFFFFDFFFCFCFCull, 0xFFFFFFFDFFF8F8F8ull, 0xFFFFFFFDFFF1F1F1ull, 0xFFFFFFFDFFE3E3E3ull,
+    0xFFFFFFFDFFC7C7C7ull, 0xFFFFFFFDFF8F8F8Full, 0xFFFFFFFDFF1F1F1Full, 0xFFFFFFFDFF3F3F3Full,
+    0xFFFFFFFDFCFCFCFFull, 0xFFFFFFFDF8F8F8FFull, 0xFFFFFFFDF1F1F1FFull, 0xFFFFFFFDE3E3E3FFull,
+    0xFFFFFFFDC7C7C7FFull, 0xFFFFFFFD8F8F8FFFull, 0xFFFFFFFD1F1F1FFFull, 0xFFFFFFFD3F3F3FFFull,
+    0xFFFFFFFCFCFCFFFFull, 0xFFFFFFF8F8F8FFFFull, 0xFFFFFFF1F1F1FFFFull, 0xFFFFFFE1E3E3FFFFull,
+    0xFFFFFFC5C7C7FFFFull, 0xFFFFFF8D8F8FFFFFull, 0xFFFFFF1D1F1FFFFFull, 0xFFFFFF3D3F3FFFFFull,
+    0x000F0C0C0C000000ull, 0x0000000000000000ull, 0x0007010101000000ull, 0x0F0F030103070000ull,
+    0x1F1F070507070000ull, 0xFFFF8F8D8FFFFFFFull, 0xFFFF1F1D1FFFFFFFull, 0xFFFF3F3D3FFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0703030103000000ull,
+    0x0F0707050F070000ull, 0xFF8F8F8DFFFFFFFFull, 0xFF1F1F1DFFFFFFFFull, 0xFF3F3F3DFFFFFFFFull,
+    0x0C0C0C0C00000000ull, 0x0000000000000000ull, 0x0101010100000000ull, 0x0303030D03000000ull,
+    0x0707071D1F070000ull, 0x8F8F8FFDFFFFFFFFull, 0x1F1F1FFDFFFFFFFFull, 0x3F3F3FFDFFFFFFFFull,
+    0x0C0C0F0D00000000ull, 0x00080F0D00000000ull, 0x01010F0D00000000ull, 0x03031F1D03000000ull,
+    0x07073F3D1F070000ull, 0x8F8FFFFDFFFFFFFFull, 0x1F1FFFFDFFFFFFFFull, 0x3F3FFFFDFFFFFFFFull,
+    0xFFFFFFFDFFFFFCFCull, 0xFFFFFFFDFFFFF8F8ull, 0xFFFFFFFDFFFFF1F1ull, 0xFFFFFFFDFFFFE3E3ull,
+    0xFFFFFFFDFFFFC7C7ull, 0xFFFFFFFDFFFF8F8Full, 0xFFFFFFFDFFFF1F1Full, 0xFFFFFFFDFFFF3F3Full,
+    0xFFFFFFFDFFFCFCFCull, 0xFFFFFFFDFFF8F8F8ull, 0xFFFFFFFDFFF1F1F1ull, 0xFFFFFFFDFFE3E3E3ull,
+    0xFFFFFFFDFFC7C7C7ull, 0xFFFFFFFDFF8F8F8Full, 0xFFFFFFFDFF1F1F1Full, 0xFFFFFFFDFF3F3F3Full,
+    0xFFFFFFFDFCFCFCFFull, 0xFFFFFFFDF8F8F8FFull, 0xFFFFFFFDF1F1F1FFull, 0xFFFFFFFDE3E3E3FFull,
+    0xFFFFFFFDC7C7C7FFull, 0xFFFFFFFD8F8F8FFFull, 0xFFFFFFFD1F1F1FFFull, 0xFFFFFFFD3F3F3FFFull,
+    0x0000070404000000ull, 0x0000070000000000ull, 0x0000070101000000ull, 0x00070F0103000000ull,
+    0x0F0F1F0507070000ull, 0x1F1F3F0D0F070000ull, 0xFFFFFF1D1F1FFFFFull, 0xFFFFFF3D3F3FFFFFull,
+    0x0000040400000000ull, 0x0000000000000000ull, 0x0000010100000000ull, 0x0007030103000000ull,
+    0x070F070503000000ull, 0x0F1F0F0D0F070000ull, 0xFFFF1F1D1FFFFFFFull, 0xFFFF3F3D3FFFFFFFull,
+    0x0000040000000000ull, 0x0000000000000000ull, 0x0000010000000000ull, 0x0003030100000000ull,
+    0x0707070503000000ull, 0x0F0F0F0D0F070000ull, 0xFF1F1F1DFFFFFFFFull, 0xFF3F3F3DFFFFFFFFull,
+    0x0004040000000000ull, 0x0000000000000000ull, 0x0001010000000000ull, 0x0303030100000000ull,
+    0x0707070D03000000ull, 0x0F0F0F1D0F070000ull, 0x1F1F1FFDFFFFFFFFull, 0x3F3F3FFDFFFFFFFFull,
+    0x0404070000000000ull, 0x0000070000000000ull, 0x0101070000000000ull, 0x03030F0100000000ull,
+    0x07071F0D03000000ull, 0x0F0F3F1D1F070000ull, 0x1F1FFFFDFFFFFFFFull, 0x3F3FFFFDFFFFFFFFull,
+    0xFFFFFFFBFFFFFCFCull, 0xFFFFFFFBFFFFF8F8ull, 0xFFFFFFFBFFFFF1F1ull, 0xFFFFFFFBFFFFE3E3ull,
+    0xFFFFFFFBFFFFC7C7ull, 0xFFFFFFFBFFFF8F8Full, 0xFFFFFFFBFFFF1F1Full, 0xFFFFFFFBFFFF3F3Full,
+    0xFFFFFFFBFFFCFCFCull, 0xFFFFFFFBFFF8F8F8ull, 0xFFFFFFFBFFF1F1F1ull, 0xFFFFFFFBFFE3E3E3ull,
+    0xFFFFFFFBFFC7C7C7ull, 0xFFFFFFFBFF8F8F8Full, 0xFFFFFFFBFF1F1F1Full, 0xFFFFFFFBFF3F3F3Full,
+    0xFFFFFFFBFCFCFCFFull, 0xFFFFFFFBF8F8F8FFull, 0xFFFFFFFBF1F1F1FFull, 0xFFFFFFFBE3E3E3FFull,
+    0xFFFFFFFBC7C7C7FFull, 0xFFFFFFFB8F8F8FFFull, 0xFFFFFFFB1F1F1FFFull, 0xFFFFFFFB3F3F3FFFull,
+    0xFFFFFFF8FCFCFFFFull, 0xFFFFFFF8F8F8FFFFull, 0xFFFFFFF1F1F1FFFFull, 0xFFFFFFE3E3E3FFFFull,
+    0xFFFFFFC3C7C7FFFFull, 0xFFFFFF8B8F8FFFFFull, 0xFFFFFF1B1F1FFFFFull, 0xFFFFFF3B3F3FFFFFull,
+    0x3F3F3C383C3E0000ull, 0x001E181818000000ull, 0x0000000000000000ull, 0x000F030303000000ull,
+    0x1F1F0703070F0000ull, 0x3F3F0F0B0F0F0000ull, 0xFFFF1F1B1FFFFFFFull, 0xFFFF3F3B3FFFFFFFull,
+    0x3E3C3C383C000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0F07070307000000ull, 0x1F0F0F0B1F0F0000ull, 0xFF1F1F1BFFFFFFFFull, 0xFF3F3F3BFFFFFFFFull,
+    0x3C3C3C3B3C000000ull, 0x1818181800000000ull, 0x0000000000000000ull, 0x0303030300000000ull,
+    0x0707071B07000000ull, 0x0F0F0F3B3F0F0000ull, 0x1F1F1FFBFFFFFFFFull, 0x3F3F3FFBFFFFFFFFull,
+    0x3C3C3F3B3C000000ull, 0x18181F1B00000000ull, 0x00111F1B00000000ull, 0x03031F1B00000000ull,
+    0x07073F3B07000000ull, 0x0F0F7F7B3F0F0000ull, 0x1F1FFFFBFFFFFFFFull, 0x3F3FFFFBFFFFFFFFull,
+    0xFFFFFFFBFFFFFCFCull, 0xFFFFFFFBFFFFF8F8ull, 0xFFFFFFFBFFFFF1F1ull, 0xFFFFFFFBFFFFE3E3ull,
+    0xFFFFFFFBFFFFC7C7ull, 0xFFFFFFFBFFFF8F8Full, 0xFFFFFFFBFFFF1F1Full, 0xFFFFFFFBFFFF3F3Full,
+    0xFFFFFFFBFFFCFCFCull, 0xFFFFFFFBFFF8F8F8ull, 0xFFFFFFFBFFF1F1F1ull, 0xFFFFFFFBFFE3E3E3ull,
+    0xFFFFFFFBFFC7C7C7ull, 0xFFFFFFFBFF8F8F8Full, 0xFFFFFFFBFF1F1F1Full, 0xFFFFFFFBFF3F3F3Full,
+    0xFFFFFFFBFCFCFCFFull, 0xFFFFFFFBF8F8F8FFull, 0xFFFFFFFBF1F1F1FFull, 0xFFFFFFFBE3E3E3FFull,
+    0xFFFFFFFBC7C7C7FFull, 0xFFFFFFFB8F8F8FFFull, 0xFFFFFFFB1F1F1FFFull, 0xFFFFFFFB3F3F3FFFull,
+    0x001E1F181C000000ull, 0x00000E0808000000ull, 0x00000E0000000000ull, 0x00000E0202000000ull,
+    0x000F1F0307000000ull, 0x1F1F3F0B0F0F0000ull, 0x3F3F7F1B1F0F0000ull, 0xFFFFFF3B3F3FFFFFull,
+    0x001E1C181C000000ull, 0x0000080800000000ull, 0x0000000000000000ull, 0x0000020200000000ull,
+    0x000F070307000000ull, 0x0F1F0F0B07000000ull, 0x1F3F1F1B1F0F0000ull, 0xFFFF3F3B3FFFFFFFull,
+    0x001C1C1800000000ull, 0x0000080000000000ull, 0x0000000000000000ull, 0x0000020000000000ull,
+    0x0007070300000000ull, 0x0F0F0F0B07000000ull, 0x1F1F1F1B1F0F0000ull, 0xFF3F3F3BFFFFFFFFull,
+    0x1C1C1C1800000000ull, 0x0008080000000000ull, 0x0000000000000000ull, 0x0002020000000000ull,
+    0x0707070300000000ull, 0x0F0F0F1B07000000ull, 0x1F1F1F3B1F0F0000ull, 0x3F3F3FFBFFFFFFFFull,
+    0x1C1C1F1800000000ull, 0x08080E0000000000ull, 0x00000E0000000000ull, 0x02020E0000000000ull,
+    0x07071F0300000000ull, 0x0F0F3F1B07000000ull, 0x1F1F7F3B3F0F0000ull, 0x3F3FFFFBFFFFFFFFull,
+    0xFFFFFFF7FFFFFCFCull, 0xFFFFFFF7FFFFF8F8ull, 0xFFFFFFF7FFFFF1F1ull, 0xFFFFFFF7FFFFE3E3ull,
+    0xFFFFFFF7FFFFC7C7ull, 0xFFFFFFF7FFFF8F8Full, 0xFFFFFFF7FFFF1F1Full, 0xFFFFFFF7FFFF3F3Full,
+    0xFFFFFFF7FFFCFCFCull, 0xFFFFFFF7FFF8F8F8ull, 0xFFFFFFF7FFF1F1F1ull, 0xFFFFFFF7FFE3E3E3ull,
+    0xFFFFFFF7FFC7C7C7ull, 0xFFFFFFF7FF8F8F8Full, 0xFFFFFFF7FF1F1F1Full, 0xFFFFFFF7FF3F3F3Full,
+    0xFFFFFFF7FCFCFCFFull, 0xFFFFFFF7F8F8F8FFull, 0xFFFFFFF7F1F1F1FFull, 0xFFFFFFF7E3E3E3FFull,
+    0xFFFFFFF7C7C7C7FFull, 0xFFFFFFF78F8F8FFFull, 0xFFFFFFF71F1F1FFFull, 0xFFFFFFF73F3F3FFFull,
+    0xFFFFFFF4FCFCFFFFull, 0xFFFFFFF0F8F8FFFFull, 0xFFFFFFF1F1F1FFFFull, 0xFFFFFFE3E3E3FFFFull,
+    0xFFFFFFC7C7C7FFFFull, 0xFFFFFF878F8FFFFFull, 0xFFFFFF171F1FFFFFull, 0xFFFFFF373F3FFFFFull,
+    0xFFFFFCF4FCFC0000ull, 0x7E7E7870787C0000ull, 0x003C303030000000ull, 0x0000000000000000ull,
+    0x001E060606000000ull, 0x3F3F0F070F1F0000ull, 0x7F7F1F171F1F0000ull, 0xFFFF3F373FFFFFFFull,
+    0xFEFCFCF4FEFC0000ull, 0x7C78787078000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x1F0F0F070F000000ull, 0x3F1F1F173F1F0000ull, 0xFF3F3F37FFFFFFFFull,
+    0xFCFCFCF7FFFC0000ull, 0x7878787678000000ull, 0x3030303000000000ull, 0x0000000000000000ull,
+    0x0606060600000000ull, 0x0F0F0F370F000000ull, 0x1F1F1F777F1F0000ull, 0x3F3F3FF7FFFFFFFFull,
+    0xFCFCFFF7FFFC0000ull, 0x78787F7778000000ull, 0x30303E3600000000ull, 0x00223E3600000000ull,
+    0x06063E3600000000ull, 0x0F0F7F770F000000ull, 0x1F1FFFF77F1F0000ull, 0x3F3FFFF7FFFFFFFFull,
+    0xFFFFFFF7FFFFFCFCull, 0xFFFFFFF7FFFFF8F8ull, 0xFFFFFFF7FFFFF1F1ull, 0xFFFFFFF7FFFFE3E3ull,
+    0xFFFFFFF7FFFFC7C7ull, 0xFFFFFFF7FFFF8F8Full, 0xFFFFFFF7FFFF1F1Full, 0xFFFFFFF7FFFF3F3Full,
+    0xFFFFFFF7FFFCFCFCull, 0xFFFFFFF7FFF8F8F8ull, 0xFFFFFFF7FFF1F1F1ull, 0xFFFFFFF7FFE3E3E3ull,
+    0xFFFFFFF7FFC7C7C7ull, 0xFFFFFFF7FF8F8F8Full, 0xFFFFFFF7FF1F1F1Full, 0xFFFFFFF7FF3F3F3Full,
+    0xFFFFFFF7FCFCFCFFull, 0xFFFFFFF7F8F8F8FFull, 0xFFFFFFF7F1F1F1FFull, 0xFFFFFFF7E3E3E3FFull,
+    0xFFFFFFF7C7C7C7FFull, 0xFFFFFFF78F8F8FFFull, 0xFFFFFFF71F1F1FFFull, 0xFFFFFFF73F3F3FFFull,
+    0x7E7E7F747C7C0000ull, 0x003C3E3038000000ull, 0x00001C1010000000ull, 0x00001C0000000000ull,
+    0x00001C0404000000ull, 0x001E3E060E000000ull, 0x3F3F7F171F1F0000ull, 0x7F7FFF373F1F0000ull,
+    0x7C7E7C7478000000ull, 0x003C383038000000ull, 0x0000101000000000ull, 0x0000000000000000ull,
+    0x0000040400000000ull, 0x001E0E060E000000ull, 0x1F3F1F170F000000ull, 0x3F7F3F373F1F0000ull,
+    0x7C7C7C7478000000ull, 0x0038383000000000ull, 0x0000100000000000ull, 0x0000000000000000ull,
+    0x0000040000000000ull, 0x000E0E0600000000ull, 0x1F1F1F170F000000ull, 0x3F3F3F373F1F0000ull,
+    0x7C7C7C7678000000ull, 0x3838383000000000ull, 0x0010100000000000ull, 0x0000000000000000ull,
+    0x0004040000000000ull, 0x0E0E0E0600000000ull, 0x1F1F1F370F000000ull, 0x3F3F3F773F1F0000ull,
+    0x7C7C7F7678000000ull, 0x38383E3000000000ull, 0x10101C0000000000ull, 0x00001C0000000000ull,
+    0x04041C0000000000ull, 0x0E0E3E0600000000ull, 0x1F1F7F370F000000ull, 0x3F3FFF777F1F0000ull,
+    0xFFFFFEFFFFFFFCFCull, 0xFFFFFEFFFFFFF8F8ull, 0xFFFFFEFFFFFFF1F1ull, 0xFFFFFEFFFFFFE3E3ull,
+    0xFFFFFEFFFFFFC7C7ull, 0xFFFFFEFFFFFF8F8Full, 0xFFFFFEFFFFFF1F1Full, 0xFFFFFEFFFFFF3F3Full,
+    0xFFFFFEFFFFFCFCFCull, 0xFFFFFEFFFFF8F8F8ull, 0xFFFFFEFFFFF1F1F1ull, 0xFFFFFEFFFFE3E3E3ull,
+    0xFFFFFEFFFFC7C7C7ull, 0xFFFFFEFFFF8F8F8Full, 0xFFFFFEFFFF1F1F1Full, 0xFFFFFEFFFF3F3F3Full,
+    0xFFFFFEFFFCFCFCFFull, 0xFFFFFEFFF8F8F8FFull, 0xFFFFFEFFF1F1F1FFull, 0xFFFFFEFFE3E3E3FFull,
+    0xFFFFFEFFC7C7C7FFull, 0xFFFFFEFF8F8F8FFFull, 0xFFFFFEFF1F1F1FFFull, 0xFFFFFEFF3F3F3FFFull,
+    0xFFFFFEFCFCFCFFFFull, 0xFFFFFEF8F8F8FFFFull, 0xFFFFFEF1F1F1FFFFull, 0xFFFFFEE3E3E3FFFFull,
+    0xFFFFFEC7C7C7FFFFull, 0xFFFFFE8F8F8FFFFFull, 0xFFFFFE1F1F1FFFFFull, 0xFFFFFE3F3F3FFFFFull,
+    0xFFFFFCFCFCFFFFFFull, 0xFFFFF8F8F8FFFFFFull, 0xFFFFF0F1F1FFFFFFull, 0xFFFFE2E3E3FFFFFFull,
+    0xFFFFC6C7C7FFFFFFull, 0xFFFF8E8F8FFFFFFFull, 0xFFFF1E1F1FFFFFFFull, 0xFFFF3E3F3FFFFFFFull,
+    0x0000000000000000ull, 0x0200000000000000ull, 0x0701000000000000ull, 0xFFE3E2E3FFFFFFFFull,
+    0xFFC7C6C7FFFFFFFFull, 0xFF8F8E8FFFFFFFFFull, 0xFF1F1E1FFFFFFFFFull, 0xFF3F3E3FFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0xE3E3E2FFFFFFFFFFull,
+    0xC7C7C6FFFFFFFFFFull, 0x8F8F8EFFFFFFFFFFull, 0x1F1F1EFFFFFFFFFFull, 0x3F3F3EFFFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000060000000000ull, 0xE3E3FEFFFFFFFFFFull,
+    0xC7C7FEFFFFFFFFFFull, 0x8F8FFEFFFFFFFFFFull, 0x1F1FFEFFFFFFFFFFull, 0x3F3FFEFFFFFFFFFFull,
+    0xFFFFFEFFFFFFFCFCull, 0xFFFFFEFFFFFFF8F8ull, 0xFFFFFEFFFFFFF1F1ull, 0xFFFFFEFFFFFFE3E3ull,
+    0xFFFFFEFFFFFFC7C7ull, 0xFFFFFEFFFFFF8F8Full, 0xFFFFFEFFFFFF1F1Full, 0xFFFFFEFFFFFF3F3Full,
+    0xFFFFFEFFFFFCFCFCull, 0xFFFFFEFFFFF8F8F8ull, 0xFFFFFEFFFFF1F1F1ull, 0xFFFFFEFFFFE3E3E3ull,
+    0xFFFFFEFFFFC7C7C7ull, 0xFFFFFEFFFF8F8F8Full, 0xFFFFFEFFFF1F1F1Full, 0xFFFFFEFFFF3F3F3Full,
+    0xFFFFFEFFFCFCFCFFull, 0xFFFFFEFFF8F8F8FFull, 0xFFFFFEFFF1F1F1FFull, 0xFFFFFEFFE3E3E3FFull,
+    0xFFFFFEFFC7C7C7FFull, 0xFFFFFEFF8F8F8FFFull, 0xFFFFFEFF1F1F1FFFull, 0xFFFFFEFF3F3F3FFFull,
+    0xFFFFFEFCFCFCFFFFull, 0xFFFFFEF8F8F8FFFFull, 0xFFFFFEF1F1F1FFFFull, 0xFFFFFEE3E3E3FFFFull,
+    0xFFFFFEC7C7C7FFFFull, 0xFFFFFE8F8F8FFFFFull, 0xFFFFFE1F1F1FFFFFull, 0xFFFFFE3F3F3FFFFFull,
+    0x0003000000000000ull, 0x0003000000000000ull, 0x0207000000000000ull, 0x070F020200000000ull,
+    0xFFFFC6C7C7FFFFFFull, 0xFFFF8E8F8FFFFFFFull, 0xFFFF1E1F1FFFFFFFull, 0xFFFF3E3F3FFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0200000000000000ull, 0x0602020000000000ull,
+    0xFFC7C6C7FFFFFFFFull, 0xFF8F8E8FFFFFFFFFull, 0xFF1F1E1FFFFFFFFFull, 0xFF3F3E3FFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202020000000000ull,
+    0xC7C7C6FFFFFFFFFFull, 0x8F8F8EFFFFFFFFFFull, 0x1F1F1EFFFFFFFFFFull, 0x3F3F3EFFFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0202060000000000ull,
+    0xC7C7FEFFFFFFFFFFull, 0x8F8FFEFFFFFFFFFFull, 0x1F1FFEFFFFFFFFFFull, 0x3F3FFEFFFFFFFFFFull,
+    0xFFFFFDFFFFFFFCFCull, 0xFFFFFDFFFFFFF8F8ull, 0xFFFFFDFFFFFFF1F1ull, 0xFFFFFDFFFFFFE3E3ull,
+    0xFFFFFDFFFFFFC7C7ull, 0xFFFFFDFFFFFF8F8Full, 0xFFFFFDFFFFFF1F1Full, 0xFFFFFDFFFFFF3F3Full,
+    0xFFFFFDFFFFFCFCFCull, 0xFFFFFDFFFFF8F8F8ull, 0xFFFFFDFFFFF1F1F1ull, 0xFFFFFDFFFFE3E3E3ull,
+    0xFFFFFDFFFFC7C7C7ull, 0xFFFFFDFFFF8F8F8Full, 0xFFFFFDFFFF1F1F1Full, 0xFFFFFDFFFF3F3F3Full,
+    0xFFFFFDFFFCFCFCFFull, 0xFFFFFDFFF8F8F8FFull, 0xFFFFFDFFF1F1F1FFull, 0xFFFFFDFFE3E3E3FFull,
+    0xFFFFFDFFC7C7C7FFull, 0xFFFFFDFF8F8F8FFFull, 0xFFFFFDFF1F1F1FFFull, 0xFFFFFDFF3F3F3FFFull,
+    0xFFFFFDFCFCFCFFFFull, 0xFFFFFDF8F8F8FFFFull, 0xFFFFFDF1F1F1FFFFull, 0xFFFFFDE3E3E3FFFFull,
+    0xFFFFFDC7C7C7FFFFull, 0xFFFFFD8F8F8FFFFFull, 0xFFFFFD1F1F1FFFFFull, 0xFFFFFD3F3F3FFFFFull,
+    0xFFFFFCFCFCFFFFFFull, 0xFFFFF8F8F8FFFFFFull, 0xFFFFF1F1F1FFFFFFull, 0xFFFFE1E3E3FFFFFFull,
+    0xFFFFC5C7C7FFFFFFull, 0xFFFF8D8F8FFFFFFFull, 0xFFFF1D1F1FFFFFFFull, 0xFFFF3D3F3FFFFFFFull,
+    0x0F0C0C0C00000000ull, 0x0000000000000000ull, 0x0701010100000000ull, 0x0F03010307000000ull,
+    0xFFC7C5C7FFFFFFFFull, 0xFF8F8D8FFFFFFFFFull, 0xFF1F1D1FFFFFFFFFull, 0xFF3F3D3FFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0303011F1F000000ull,
+    0xC7C7C5FFFFFFFFFFull, 0x8F8F8DFFFFFFFFFFull, 0x1F1F1DFFFFFFFFFFull, 0x3F3F3DFFFFFFFFFFull,
+    0x040C080F00000000ull, 0x0000050000000000ull, 0x0101090F00000000ull, 0x03031D1F1F000000ull,
+    0xC7C7FDFFFFFFFFFFull, 0x8F8FFDFFFFFFFFFFull, 0x1F1FFDFFFFFFFFFFull, 0x3F3FFDFFFFFFFFFFull,
+    0xFFFFFDFFFFFFFCFCull, 0xFFFFFDFFFFFFF8F8ull, 0xFFFFFDFFFFFFF1F1ull, 0xFFFFFDFFFFFFE3E3ull,
+    0xFFFFFDFFFFFFC7C7ull, 0xFFFFFDFFFFFF8F8Full, 0xFFFFFDFFFFFF1F1Full, 0xFFFFFDFFFFFF3F3Full,
+    0xFFFFFDFFFFFCFCFCull, 0xFFFFFDFFFFF8F8F8ull, 0xFFFFFDFFFFF1F1F1ull, 0xFFFFFDFFFFE3E3E3ull,
+    0xFFFFFDFFFFC7C7C7ull, 0xFFFFFDFFFF8F8F8Full, 0xFFFFFDFFFF1F1F1Full, 0xFFFFFDFFFF3F3F3Full,
+    0xFFFFFDFFFCFCFCFFull, 0xFFFFFDFFF8F8F8FFull, 0xFFFFFDFFF1F1F1FFull, 0xFFFFFDFFE3E3E3FFull,
+    0xFFFFFDFFC7C7C7FFull, 0xFFFFFDFF8F8F8FFFull, 0xFFFFFDFF1F1F1FFFull, 0xFFFFFDFF3F3F3FFFull,
+    0xFFFFFDFCFCFCFFFFull, 0xFFFFFDF8F8F8FFFFull, 0xFFFFFDF1F1F1FFFFull, 0xFFFFFDE3E3E3FFFFull,
+    0xFFFFFDC7C7C7FFFFull, 0xFFFFFD8F8F8FFFFFull, 0xFFFFFD1F1F1FFFFFull, 0xFFFFFD3F3F3FFFFFull,
+    0x0007040400000000ull, 0x0007000000000000ull, 0x0007010100000000ull, 0x070F010300000000ull,
+    0x0F1F050707000000ull, 0xFFFF8D8F8FFFFFFFull, 0xFFFF1D1F1FFFFFFFull, 0xFFFF3D3F3FFFFFFFull,
+    0x0004040000000000ull, 0x0000000000000000ull, 0x0001010000000000ull, 0x0703010300000000ull,
+    0x0F07050707000000ull, 0xFF8F8D8FFFFFFFFFull, 0xFF1F1D1FFFFFFFFFull, 0xFF3F3D3FFFFFFFFFull,
+    0x0004000000000000ull, 0x0000000000000000ull, 0x0001010000000000ull, 0x0303010F00000000ull,
+    0x0707051F07000000ull, 0x8F8F8DFFFFFFFFFFull, 0x1F1F1DFFFFFFFFFFull, 0x3F3F3DFFFFFFFFFFull,
+    0x0000050000000000ull, 0x0000000000000000ull, 0x0101050000000000ull, 0x0303090F00000000ull,
+    0x07071D1F1F000000ull, 0x8F8FFDFFFFFFFFFFull, 0x1F1FFDFFFFFFFFFFull, 0x3F3FFDFFFFFFFFFFull,
+    0xFFFFFBFFFFFFFCFCull, 0xFFFFFBFFFFFFF8F8ull, 0xFFFFFBFFFFFFF1F1ull, 0xFFFFFBFFFFFFE3E3ull,
+    0xFFFFFBFFFFFFC7C7ull, 0xFFFFFBFFFFFF8F8Full, 0xFFFFFBFFFFFF1F1Full, 0xFFFFFBFFFFFF3F3Full,
+    0xFFFFFBFFFFFCFCFCull, 0xFFFFFBFFFFF8F8F8ull, 0xFFFFFBFFFFF1F1F1ull, 0xFFFFFBFFFFE3E3E3ull,
+    0xFFFFFBFFFFC7C7C7ull, 0xFFFFFBFFFF8F8F8Full, 0xFFFFFBFFFF1F1F1Full, 0xFFFFFBFFFF3F3F3Full,
+    0xFFFFFBFFFCFCFCFFull, 0xFFFFFBFFF8F8F8FFull, 0xFFFFFBFFF1F1F1FFull, 0xFFFFFBFFE3E3E3FFull,
+    0xFFFFFBFFC7C7C7FFull, 0xFFFFFBFF8F8F8FFFull, 0xFFFFFBFF1F1F1FFFull, 0xFFFFFBFF3F3F3FFFull,
+    0xFFFFFBFCFCFCFFFFull, 0xFFFFFBF8F8F8FFFFull, 0xFFFFFBF1F1F1FFFFull, 0xFFFFFBE3E3E3FFFFull,
+    0xFFFFFBC7C7C7FFFFull, 0xFFFFFB8F8F8FFFFFull, 0xFFFFFB1F1F1FFFFFull, 0xFFFFFB3F3F3FFFFFull,
+    0xFFFFF8FCFCFFFFFFull, 0xFFFFF8F8F8FFFFFFull, 0xFFFFF1F1F1FFFFFFull, 0xFFFFE3E3E3FFFFFFull,
+    0xFFFFC3C7C7FFFFFFull, 0xFFFF8B8F8FFFFFFFull, 0xFFFF1B1F1FFFFFFFull, 0xFFFF3B3F3FFFFFFFull,
+    0x3F3C383C3E000000ull, 0x1E18181800000000ull, 0x0000000000000000ull, 0x0F03030300000000ull,
+    0x1F0703070F000000ull, 0xFF8F8B8FFFFFFFFFull, 0xFF1F1B1FFFFFFFFFull, 0xFF3F3B3FFFFFFFFFull,
+    0x3C3C383F3F000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0707033F3F000000ull, 0x8F8F8BFFFFFFFFFFull, 0x1F1F1BFFFFFFFFFFull, 0x3F3F3BFFFFFFFFFFull,
+    0x3C3C3B3F3F000000ull, 0x1818191F00000000ull, 0x00000A0000000000ull, 0x0303131F00000000ull,
+    0x07073B3F3F000000ull, 0x8F8FFBFFFFFFFFFFull, 0x1F1FFBFFFFFFFFFFull, 0x3F3FFBFFFFFFFFFFull,
+    0xFFFFFBFFFFFFFCFCull, 0xFFFFFBFFFFFFF8F8ull, 0xFFFFFBFFFFFFF1F1ull, 0xFFFFFBFFFFFFE3E3ull,
+    0xFFFFFBFFFFFFC7C7ull, 0xFFFFFBFFFFFF8F8Full, 0xFFFFFBFFFFFF1F1Full, 0xFFFFFBFFFFFF3F3Full,
+    0xFFFFFBFFFFFCFCFCull, 0xFFFFFBFFFFF8F8F8ull, 0xFFFFFBFFFFF1F1F1ull, 0xFFFFFBFFFFE3E3E3ull,
+    0xFFFFFBFFFFC7C7C7ull, 0xFFFFFBFFFF8F8F8Full, 0xFFFFFBFFFF1F1F1Full, 0xFFFFFBFFFF3F3F3Full,
+    0xFFFFFBFFFCFCFCFFull, 0xFFFFFBFFF8F8F8FFull, 0xFFFFFBFFF1F1F1FFull, 0xFFFFFBFFE3E3E3FFull,
+    0xFFFFFBFFC7C7C7FFull, 0xFFFFFBFF8F8F8FFFull, 0xFFFFFBFF1F1F1FFFull, 0xFFFFFBFF3F3F3FFFull,
+    0xFFFFFBFCFCFCFFFFull, 0xFFFFFBF8F8F8FFFFull, 0xFFFFFBF1F1F1FFFFull, 0xFFFFFBE3E3E3FFFFull,
+    0xFFFFFBC7C7C7FFFFull, 0xFFFFFB8F8F8FFFFFull, 0xFFFFFB1F1F1FFFFFull, 0xFFFFFB3F3F3FFFFFull,
+    0x1E1F181C00000000ull, 0x000E080800000000ull, 0x000E000000000000ull, 0x000E020200000000ull,
+    0x0F1F030700000000ull, 0x1F3F0B0F0F000000ull, 0xFFFF1B1F1FFFFFFFull, 0xFFFF3B3F3FFFFFFFull,
+    0x1E1C181C00000000ull, 0x0008080000000000ull, 0x0000000000000000ull, 0x0002020000000000ull,
+    0x0F07030700000000ull, 0x1F0F0B0F0F000000ull, 0xFF1F1B1FFFFFFFFFull, 0xFF3F3B3FFFFFFFFFull,
+    0x1C1C181F00000000ull, 0x0008080000000000ull, 0x0000000000000000ull, 0x0002020000000000ull,
+    0x0707031F00000000ull, 0x0F0F0B3F0F000000ull, 0x1F1F1BFFFFFFFFFFull, 0x3F3F3BFFFFFFFFFFull,
+    0x1C1C191F00000000ull, 0x08080A0000000000ull, 0x0000000000000000ull, 0x02020A0000000000ull,
+    0x0707131F00000000ull, 0x0F0F3B3F3F000000ull, 0x1F1FFBFFFFFFFFFFull, 0x3F3FFBFFFFFFFFFFull,
+    0xFFFFF7FFFFFFFCFCull, 0xFFFFF7FFFFFFF8F8ull, 0xFFFFF7FFFFFFF1F1ull, 0xFFFFF7FFFFFFE3E3ull,
+    0xFFFFF7FFFFFFC7C7ull, 0xFFFFF7FFFFFF8F8Full, 0xFFFFF7FFFFFF1F1Full, 0xFFFFF7FFFFFF3F3Full,
+    0xFFFFF7FFFFFCFCFCull, 0xFFFFF7FFFFF8F8F8ull, 0xFFFFF7FFFFF1F1F1ull, 0xFFFFF7FFFFE3E3E3ull,
+    0xFFFFF7FFFFC7C7C7ull, 0xFFFFF7FFFF8F8F8Full, 0xFFFFF7FFFF1F1F1Full, 0xFFFFF7FFFF3F3F3Full,
+    0xFFFFF7FFFCFCFCFFull, 0xFFFFF7FFF8F8F8FFull, 0xFFFFF7FFF1F1F1FFull, 0xFFFFF7FFE3E3E3FFull,
+    0xFFFFF7FFC7C7C7FFull, 0xFFFFF7FF8F8F8FFFull, 0xFFFFF7FF1F1F1FFFull, 0xFFFFF7FF3F3F3FFFull,
+    0xFFFFF7FCFCFCFFFFull, 0xFFFFF7F8F8F8FFFFull, 0xFFFFF7F1F1F1FFFFull, 0xFFFFF7E3E3E3FFFFull,
+    0xFFFFF7C7C7C7FFFFull, 0xFFFFF78F8F8FFFFFull, 0xFFFFF71F1F1FFFFFull, 0xFFFFF73F3F3FFFFFull,
+    0xFFFFF4FCFCFFFFFFull, 0xFFFFF0F8F8FFFFFFull, 0xFFFFF1F1F1FFFFFFull, 0xFFFFE3E3E3FFFFFFull,
+    0xFFFFC7C7C7FFFFFFull, 0xFFFF878F8FFFFFFFull, 0xFFFF171F1FFFFFFFull, 0xFFFF373F3FFFFFFFull,
+    0xFFFCF4FCFFFFFFFFull, 0x7E7870787C000000ull, 0x3C30303000000000ull, 0x0000000000000000ull,
+    0x1E06060600000000ull, 0x3F0F070F1F000000ull, 0xFF1F171FFFFFFFFFull, 0xFF3F373FFFFFFFFFull,
+    0xFCFCF4FFFFFFFFFFull, 0x7878707F7F000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0F0F077F7F000000ull, 0x1F1F17FFFFFFFFFFull, 0x3F3F37FFFFFFFFFFull,
+    0xFCFCF7FFFFFFFFFFull, 0x7878777F7F000000ull, 0x3030323E00000000ull, 0x0000140000000000ull,
+    0x0606263E00000000ull, 0x0F0F777F7F000000ull, 0x1F1FF7FFFFFFFFFFull, 0x3F3FF7FFFFFFFFFFull,
+    0xFFFFF7FFFFFFFCFCull, 0xFFFFF7FFFFFFF8F8ull, 0xFFFFF7FFFFFFF1F1ull, 0xFFFFF7FFFFFFE3E3ull,
+    0xFFFFF7FFFFFFC7C7ull, 0xFFFFF7FFFFFF8F8Full, 0xFFFFF7FFFFFF1F1Full, 0xFFFFF7FFFFFF3F3Full,
+    0xFFFFF7FFFFFCFCFCull, 0xFFFFF7FFFFF8F8F8ull, 0xFFFFF7FFFFF1F1F1ull, 0xFFFFF7FFFFE3E3E3ull,
+    0xFFFFF7FFFFC7C7C7ull, 0xFFFFF7FFFF8F8F8Full, 0xFFFFF7FFFF1F1F1Full, 0xFFFFF7FFFF3F3F3Full,
+    0xFFFFF7FFFCFCFCFFull, 0xFFFFF7FFF8F8F8FFull, 0xFFFFF7FFF1F1F1FFull, 0xFFFFF7FFE3E3E3FFull,
+    0xFFFFF7FFC7C7C7FFull, 0xFFFFF7FF8F8F8FFFull, 0xFFFFF7FF1F1F1FFFull, 0xFFFFF7FF3F3F3FFFull,
+    0xFFFFF7FCFCFCFFFFull, 0xFFFFF7F8F8F8FFFFull, 0xFFFFF7F1F1F1FFFFull, 0xFFFFF7E3E3E3FFFFull,
+    0xFFFFF7C7C7C7FFFFull, 0xFFFFF78F8F8FFFFFull, 0xFFFFF71F1F1FFFFFull, 0xFFFFF73F3F3FFFFFull,
+    0x7E7F747C7C000000ull, 0x3C3E303800000000ull, 0x001C101000000000ull, 0x001C000000000000ull,
+    0x001C040400000000ull, 0x1E3E060E00000000ull, 0x3F7F171F1F000000ull, 0xFFFF373F3FFFFFFFull,
+    0x7E7C747C7C000000ull, 0x3C38303800000000ull, 0x0010100000000000ull, 0x0000000000000000ull,
+    0x0004040000000000ull, 0x1E0E060E00000000ull, 0x3F1F171F1F000000ull, 0xFF3F373FFFFFFFFFull,
+    0x7C7C747F7C000000ull, 0x3838303E00000000ull, 0x0010100000000000ull, 0x0000000000000000ull,
+    0x0004040000000000ull, 0x0E0E063E00000000ull, 0x1F1F177F1F000000ull, 0x3F3F37FFFFFFFFFFull,
+    0x7C7C777F7F000000ull, 0x3838323E00000000ull, 0x1010140000000000ull, 0x0000000000000000ull,
+    0x0404140000000000ull, 0x0E0E263E00000000ull, 0x1F1F777F7F000000ull, 0x3F3FF7FFFFFFFFFFull,
+    0xFFFEFFFFFFFFFCFCull, 0xFFFEFFFFFFFFF8F8ull, 0xFFFEFFFFFFFFF1F1ull, 0xFFFEFFFFFFFFE3E3ull,
+    0xFFFEFFFFFFFFC7C7ull, 0xFFFEFFFFFFFF8F8Full, 0xFFFEFFFFFFFF1F1Full, 0xFFFEFFFFFFFF3F3Full,
+    0xFFFEFFFFFFFCFCFCull, 0xFFFEFFFFFFF8F8F8ull, 0xFFFEFFFFFFF1F1F1ull, 0xFFFEFFFFFFE3E3E3ull,
+    0xFFFEFFFFFFC7C7C7ull, 0xFFFEFFFFFF8F8F8Full, 0xFFFEFFFFFF1F1F1Full, 0xFFFEFFFFFF3F3F3Full,
+    0xFFFEFFFFFCFCFCFFull, 0xFFFEFFFFF8F8F8FFull, 0xFFFEFFFFF1F1F1FFull, 0xFFFEFFFFE3E3E3FFull,
+    0xFFFEFFFFC7C7C7FFull, 0xFFFEFFFF8F8F8FFFull, 0xFFFEFFFF1F1F1FFFull, 0xFFFEFFFF3F3F3FFFull,
+    0xFFFEFFFCFCFCFFFFull, 0xFFFEFFF8F8F8FFFFull, 0xFFFEFFF1F1F1FFFFull, 0xFFFEFFE3E3E3FFFFull,
+    0xFFFEFFC7C7C7FFFFull, 0xFFFEFF8F8F8FFFFFull, 0xFFFEFF1F1F1FFFFFull, 0xFFFEFF3F3F3FFFFFull,
+    0xFFFEFCFCFCFFFFFFull, 0xFFFEF8F8F8FFFFFFull, 0xFFFEF1F1F1FFFFFFull, 0xFFFEE3E3E3FFFFFFull,
+    0xFFFEC7C7C7FFFFFFull, 0xFFFE8F8F8FFFFFFFull, 0xFFFE1F1F1FFFFFFFull, 0xFFFE3F3F3FFFFFFFull,
+    0xFFFCFCFCFFFFFFFFull, 0xFFF8F8F8FFFFFFFFull, 0xFFF0F1F1FFFFFFFFull, 0xFFE2E3E3FFFFFFFFull,
+    0xFFC6C7C7FFFFFFFFull, 0xFF8E8F8FFFFFFFFFull, 0xFF1E1F1FFFFFFFFFull, 0xFF3E3F3FFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0xF0F0F1FFFFFFFFFFull, 0xE3E2E3FFFFFFFFFFull,
+    0xC7C6C7FFFFFFFFFFull, 0x8F8E8FFFFFFFFFFFull, 0x1F1E1FFFFFFFFFFFull, 0x3F3E3FFFFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0xF0F0FFFFFFFFFFFFull, 0xE3E2FFFFFFFFFFFFull,
+    0xC7C6FFFFFFFFFFFFull, 0x8F8EFFFFFFFFFFFFull, 0x1F1EFFFFFFFFFFFFull, 0x3F3EFFFFFFFFFFFFull,
+    0xFFFEFFFFFFFFFCFCull, 0xFFFEFFFFFFFFF8F8ull, 0xFFFEFFFFFFFFF1F1ull, 0xFFFEFFFFFFFFE3E3ull,
+    0xFFFEFFFFFFFFC7C7ull, 0xFFFEFFFFFFFF8F8Full, 0xFFFEFFFFFFFF1F1Full, 0xFFFEFFFFFFFF3F3Full,
+    0xFFFEFFFFFFFCFCFCull, 0xFFFEFFFFFFF8F8F8ull, 0xFFFEFFFFFFF1F1F1ull, 0xFFFEFFFFFFE3E3E3ull,
+    0xFFFEFFFFFFC7C7C7ull, 0xFFFEFFFFFF8F8F8Full, 0xFFFEFFFFFF1F1F1Full, 0xFFFEFFFFFF3F3F3Full,
+    0xFFFEFFFFFCFCFCFFull, 0xFFFEFFFFF8F8F8FFull, 0xFFFEFFFFF1F1F1FFull, 0xFFFEFFFFE3E3E3FFull,
+    0xFFFEFFFFC7C7C7FFull, 0xFFFEFFFF8F8F8FFFull, 0xFFFEFFFF1F1F1FFFull, 0xFFFEFFFF3F3F3FFFull,
+    0xFFFEFFFCFCFCFFFFull, 0xFFFEFFF8F8F8FFFFull, 0xFFFEFFF1F1F1FFFFull, 0xFFFEFFE3E3E3FFFFull,
+    0xFFFEFFC7C7C7FFFFull, 0xFFFEFF8F8F8FFFFFull, 0xFFFEFF1F1F1FFFFFull, 0xFFFEFF3F3F3FFFFFull,
+    0xFFFEFCFCFCFFFFFFull, 0xFFFEF8F8F8FFFFFFull, 0xFFFEF1F1F1FFFFFFull, 0xFFFEE3E3E3FFFFFFull,
+    0xFFFEC7C7C7FFFFFFull, 0xFFFE8F8F8FFFFFFFull, 0xFFFE1F1F1FFFFFFFull, 0xFFFE3F3F3FFFFFFFull,
+    0x0300000000000000ull, 0x0200000000000000ull, 0x0600010000000000ull, 0xFEE2E3E3FFFFFFFFull,
+    0xFFC6C7C7FFFFFFFFull, 0xFF8E8F8FFFFFFFFFull, 0xFF1E1F1FFFFFFFFFull, 0xFF3E3F3FFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000010000000000ull, 0xE2E2E3FFFFFFFFFFull,
+    0xC7C6C7FFFFFFFFFFull, 0x8F8E8FFFFFFFFFFFull, 0x1F1E1FFFFFFFFFFFull, 0x3F3E3FFFFFFFFFFFull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000070000000000ull, 0xE2E2FFFFFFFFFFFFull,
+    0xC7C6FFFFFFFFFFFFull, 0x8F8EFFFFFFFFFFFFull, 0x1F1EFFFFFFFFFFFFull, 0x3F3EFFFFFFFFFFFFull,
+    0xFFFDFFFFFFFFFCFCull, 0xFFFDFFFFFFFFF8F8ull, 0xFFFDFFFFFFFFF1F1ull, 0xFFFDFFFFFFFFE3E3ull,
+    0xFFFDFFFFFFFFC7C7ull, 0xFFFDFFFFFFFF8F8Full, 0xFFFDFFFFFFFF1F1Full, 0xFFFDFFFFFFFF3F3Full,
+    0xFFFDFFFFFFFCFCFCull, 0xFFFDFFFFFFF8F8F8ull, 0xFFFDFFFFFFF1F1F1ull, 0xFFFDFFFFFFE3E3E3ull,
+    0xFFFDFFFFFFC7C7C7ull, 0xFFFDFFFFFF8F8F8Full, 0xFFFDFFFFFF1F1F1Full, 0xFFFDFFFFFF3F3F3Full,
+    0xFFFDFFFFFCFCFCFFull, 0xFFFDFFFFF8F8F8FFull, 0xFFFDFFFFF1F1F1FFull, 0xFFFDFFFFE3E3E3FFull,
+    0xFFFDFFFFC7C7C7FFull, 0xFFFDFFFF8F8F8FFFull, 0xFFFDFFFF1F1F1FFFull, 0xFFFDFFFF3F3F3FFFull,
+    0xFFFDFFFCFCFCFFFFull, 0xFFFDFFF8F8F8FFFFull, 0xFFFDFFF1F1F1FFFFull, 0xFFFDFFE3E3E3FFFFull,
+    0xFFFDFFC7C7C7FFFFull, 0xFFFDFF8F8F8FFFFFull, 0xFFFDFF1F1F1FFFFFull, 0xFFFDFF3F3F3FFFFFull,
+    0xFFFDFCFCFCFFFFFFull, 0xFFFDF8F8F8FFFFFFull, 0xFFFDF1F1F1FFFFFFull, 0xFFFDE3E3E3FFFFFFull,
+    0xFFFDC7C7C7FFFFFFull, 0xFFFD8F8F8FFFFFFFull, 0xFFFD1F1F1FFFFFFFull, 0xFFFD3F3F3FFFFFFFull,
+    0xFFFCFCFCFFFFFFFFull, 0xFFF8F8F8FFFFFFFFull, 0xFFF1F1F1FFFFFFFFull, 0xFFE1E3E3FFFFFFFFull,
+    0xFFC5C7C7FFFFFFFFull, 0xFF8D8F8FFFFFFFFFull, 0xFF1D1F1FFFFFFFFFull, 0xFF3D3F3FFFFFFFFFull,
+    0x0C0C0C0000000000ull, 0x0000000000000000ull, 0x0101010000000000ull, 0xE3E1E3FFFFFFFFFFull,
+    0xC7C5C7FFFFFFFFFFull, 0x8F8D8FFFFFFFFFFFull, 0x1F1D1FFFFFFFFFFFull, 0x3F3D3FFFFFFFFFFFull,
+    0x0000000000000000ull, 0x00080A0F00000000ull, 0x0000000000000000ull, 0xE3E1FFFFFFFFFFFFull,
+    0xC7C5FFFFFFFFFFFFull, 0x8F8DFFFFFFFFFFFFull, 0x1F1DFFFFFFFFFFFFull, 0x3F3DFFFFFFFFFFFFull,
+    0xFFFDFFFFFFFFFCFCull, 0xFFFDFFFFFFFFF8F8ull, 0xFFFDFFFFFFFFF1F1ull, 0xFFFDFFFFFFFFE3E3ull,
+    0xFFFDFFFFFFFFC7C7ull, 0xFFFDFFFFFFFF8F8Full, 0xFFFDFFFFFFFF1F1Full, 0xFFFDFFFFFFFF3F3Full,
+    0xFFFDFFFFFFFCFCFCull, 0xFFFDFFFFFFF8F8F8ull, 0xFFFDFFFFFFF1F1F1ull, 0xFFFDFFFFFFE3E3E3ull,
+    0xFFFDFFFFFFC7C7C7ull, 0xFFFDFFFFFF8F8F8Full, 0xFFFDFFFFFF1F1F1Full, 0xFFFDFFFFFF3F3F3Full,
+    0xFFFDFFFFFCFCFCFFull, 0xFFFDFFFFF8F8F8FFull, 0xFFFDFFFFF1F1F1FFull, 0xFFFDFFFFE3E3E3FFull,
+    0xFFFDFFFFC7C7C7FFull, 0xFFFDFFFF8F8F8FFFull, 0xFFFDFFFF1F1F1FFFull, 0xFFFDFFFF3F3F3FFFull,
+    0xFFFDFFFCFCFCFFFFull, 0xFFFDFFF8F8F8FFFFull, 0xFFFDFFF1F1F1FFFFull, 0xFFFDFFE3E3E3FFFFull,
+    0xFFFDFFC7C7C7FFFFull, 0xFFFDFF8F8F8FFFFFull, 0xFFFDFF1F1F1FFFFFull, 0xFFFDFF3F3F3FFFFFull,
+    0xFFFDFCFCFCFFFFFFull, 0xFFFDF8F8F8FFFFFFull, 0xFFFDF1F1F1FFFFFFull, 0xFFFDE3E3E3FFFFFFull,
+    0xFFFDC7C7C7FFFFFFull, 0xFFFD8F8F8FFFFFFFull, 0xFFFD1F1F1FFFFFFFull, 0xFFFD3F3F3FFFFFFFull,
+    0x0704040000000000ull, 0x0700000000000000ull, 0x0701010000000000ull, 0x0F01030000000000ull,
+    0xFFC5C7C7FFFFFFFFull, 0xFF8D8F8FFFFFFFFFull, 0xFF1D1F1FFFFFFFFFull, 0xFF3D3F3FFFFFFFFFull,
+    0x0404000000000000ull, 0x0000000000000000ull, 0x0101000000000000ull, 0x0301030000000000ull,
+    0xC7C5C7FFFFFFFFFFull, 0x8F8D8FFFFFFFFFFFull, 0x1F1D1FFFFFFFFFFFull, 0x3F3D3FFFFFFFFFFFull,
+    0x0404020000000000ull, 0x0000050000000000ull, 0x0101020000000000ull, 0x03010F0000000000ull,
+    0xC7C5FFFFFFFFFFFFull, 0x8F8DFFFFFFFFFFFFull, 0x1F1DFFFFFFFFFFFFull, 0x3F3DFFFFFFFFFFFFull,
+    0xFFFBFFFFFFFFFCFCull, 0xFFFBFFFFFFFFF8F8ull, 0xFFFBFFFFFFFFF1F1ull, 0xFFFBFFFFFFFFE3E3ull,
+    0xFFFBFFFFFFFFC7C7ull, 0xFFFBFFFFFFFF8F8Full, 0xFFFBFFFFFFFF1F1Full, 0xFFFBFFFFFFFF3F3Full,
+    0xFFFBFFFFFFFCFCFCull, 0xFFFBFFFFFFF8F8F8ull, 0xFFFBFFFFFFF1F1F1ull, 0xFFFBFFFFFFE3E3E3ull,
+    0xFFFBFFFFFFC7C7C7ull, 0xFFFBFFFFFF8F8F8Full, 0xFFFBFFFFFF1F1F1Full, 0xFFFBFFFFFF3F3F3Full,
+    0xFFFBFFFFFCFCFCFFull, 0xFFFBFFFFF8F8F8FFull, 0xFFFBFFFFF1F1F1FFull, 0xFFFBFFFFE3E3E3FFull,
+    0xFFFBFFFFC7C7C7FFull, 0xFFFBFFFF8F8F8FFFull, 0xFFFBFFFF1F1F1FFFull, 0xFFFBFFFF3F3F3FFFull,
+    0xFFFBFFFCFCFCFFFFull, 0xFFFBFFF8F8F8FFFFull, 0xFFFBFFF1F1F1FFFFull, 0xFFFBFFE3E3E3FFFFull,
+    0xFFFBFFC7C7C7FFFFull, 0xFFFBFF8F8F8FFFFFull, 0xFFFBFF1F1F1FFFFFull, 0xFFFBFF3F3F3FFFFFull,
+    0xFFFBFCFCFCFFFFFFull, 0xFFFBF8F8F8FFFFFFull, 0xFFFBF1F1F1FFFFFFull, 0xFFFBE3E3E3FFFFFFull,
+    0xFFFBC7C7C7FFFFFFull, 0xFFFB8F8F8FFFFFFFull, 0xFFFB1F1F1FFFFFFFull, 0xFFFB3F3F3FFFFFFFull,
+    0xFFF8FCFCFFFFFFFFull, 0xFFF8F8F8FFFFFFFFull, 0xFFF1F1F1FFFFFFFFull, 0xFFE3E3E3FFFFFFFFull,
+    0xFFC3C7C7FFFFFFFFull, 0xFF8B8F8FFFFFFFFFull, 0xFF1B1F1FFFFFFFFFull, 0xFF3B3F3FFFFFFFFFull,
+    0xFCF8FCFFFFFFFFFFull, 0x1818180000000000ull, 0x0000000000000000ull, 0x0303030000000000ull,
+    0xC7C3C7FFFFFFFFFFull, 0x8F8B8FFFFFFFFFFFull, 0x1F1B1FFFFFFFFFFFull, 0x3F3B3FFFFFFFFFFFull,
+    0xFCF8FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0011151F00000000ull, 0x0000000000000000ull,
+    0xC7C3FFFFFFFFFFFFull, 0x8F8BFFFFFFFFFFFFull, 0x1F1BFFFFFFFFFFFFull, 0x3F3BFFFFFFFFFFFFull,
+    0xFFFBFFFFFFFFFCFCull, 0xFFFBFFFFFFFFF8F8ull, 0xFFFBFFFFFFFFF1F1ull, 0xFFFBFFFFFFFFE3E3ull,
+    0xFFFBFFFFFFFFC7C7ull, 0xFFFBFFFFFFFF8F8Full, 0xFFFBFFFFFFFF1F1Full, 0xFFFBFFFFFFFF3F3Full,
+    0xFFFBFFFFFFFCFCFCull, 0xFFFBFFFFFFF8F8F8ull, 0xFFFBFFFFFFF1F1F1ull, 0xFFFBFFFFFFE3E3E3ull,
+    0xFFFBFFFFFFC7C7C7ull, 0xFFFBFFFFFF8F8F8Full, 0xFFFBFFFFFF1F1F1Full, 0xFFFBFFFFFF3F3F3Full,
+    0xFFFBFFFFFCFCFCFFull, 0xFFFBFFFFF8F8F8FFull, 0xFFFBFFFFF1F1F1FFull, 0xFFFBFFFFE3E3E3FFull,
+    0xFFFBFFFFC7C7C7FFull, 0xFFFBFFFF8F8F8FFFull, 0xFFFBFFFF1F1F1FFFull, 0xFFFBFFFF3F3F3FFFull,
+    0xFFFBFFFCFCFCFFFFull, 0xFFFBFFF8F8F8FFFFull, 0xFFFBFFF1F1F1FFFFull, 0xFFFBFFE3E3E3FFFFull,
+    0xFFFBFFC7C7C7FFFFull, 0xFFFBFF8F8F8FFFFFull, 0xFFFBFF1F1F1FFFFFull, 0xFFFBFF3F3F3FFFFFull,
+    0xFFFBFCFCFCFFFFFFull, 0xFFFBF8F8F8FFFFFFull, 0xFFFBF1F1F1FFFFFFull, 0xFFFBE3E3E3FFFFFFull,
+    0xFFFBC7C7C7FFFFFFull, 0xFFFB8F8F8FFFFFFFull, 0xFFFB1F1F1FFFFFFFull, 0xFFFB3F3F3FFFFFFFull,
+    0x1F181C0000000000ull, 0x0E08080000000000ull, 0x0E00000000000000ull, 0x0E02020000000000ull,
+    0x1F03070000000000ull, 0xFF8B8F8FFFFFFFFFull, 0xFF1B1F1FFFFFFFFFull, 0xFF3B3F3FFFFFFFFFull,
+    0x1C181C0000000000ull, 0x0808000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0703070000000000ull, 0x8F8B8FFFFFFFFFFFull, 0x1F1B1FFFFFFFFFFFull, 0x3F3B3FFFFFFFFFFFull,
+    0x1C181C0000000000ull, 0x0808040000000000ull, 0x00000A0000000000ull, 0x0202040000000000ull,
+    0x07031F0000000000ull, 0x8F8BFFFFFFFFFFFFull, 0x1F1BFFFFFFFFFFFFull, 0x3F3BFFFFFFFFFFFFull,
+    0xFFF7FFFFFFFFFCFCull, 0xFFF7FFFFFFFFF8F8ull, 0xFFF7FFFFFFFFF1F1ull, 0xFFF7FFFFFFFFE3E3ull,
+    0xFFF7FFFFFFFFC7C7ull, 0xFFF7FFFFFFFF8F8Full, 0xFFF7FFFFFFFF1F1Full, 0xFFF7FFFFFFFF3F3Full,
+    0xFFF7FFFFFFFCFCFCull, 0xFFF7FFFFFFF8F8F8ull, 0xFFF7FFFFFFF1F1F1ull, 0xFFF7FFFFFFE3E3E3ull,
+    0xFFF7FFFFFFC7C7C7ull, 0xFFF7FFFFFF8F8F8Full, 0xFFF7FFFFFF1F1F1Full, 0xFFF7FFFFFF3F3F3Full,
+    0xFFF7FFFFFCFCFCFFull, 0xFFF7FFFFF8F8F8FFull, 0xFFF7FFFFF1F1F1FFull, 0xFFF7FFFFE3E3E3FFull,
+    0xFFF7FFFFC7C7C7FFull, 0xFFF7FFFF8F8F8FFFull, 0xFFF7FFFF1F1F1FFFull, 0xFFF7FFFF3F3F3FFFull,
+    0xFFF7FFFCFCFCFFFFull, 0xFFF7FFF8F8F8FFFFull, 0xFFF7FFF1F1F1FFFFull, 0xFFF7FFE3E3E3FFFFull,
+    0xFFF7FFC7C7C7FFFFull, 0xFFF7FF8F8F8FFFFFull, 0xFFF7FF1F1F1FFFFFull, 0xFFF7FF3F3F3FFFFFull,
+    0xFFF7FCFCFCFFFFFFull, 0xFFF7F8F8F8FFFFFFull, 0xFFF7F1F1F1FFFFFFull, 0xFFF7E3E3E3FFFFFFull,
+    0xFFF7C7C7C7FFFFFFull, 0xFFF78F8F8FFFFFFFull, 0xFFF71F1F1FFFFFFFull, 0xFFF73F3F3FFFFFFFull,
+    0xFFF4FCFCFFFFFFFFull, 0xFFF0F8F8FFFFFFFFull, 0xFFF1F1F1FFFFFFFFull, 0xFFE3E3E3FFFFFFFFull,
+    0xFFC7C7C7FFFFFFFFull, 0xFF878F8FFFFFFFFFull, 0xFF171F1FFFFFFFFFull, 0xFF373F3FFFFFFFFFull,
+    0xFCF4FCFFFFFFFFFFull, 0xF8F0F8FFFFFFFFFFull, 0x3030300000000000ull, 0x0000000000000000ull,
+    0x0606060000000000ull, 0x8F878FFFFFFFFFFFull, 0x1F171FFFFFFFFFFFull, 0x3F373FFFFFFFFFFFull,
+    0xFCF4FFFFFFFFFFFFull, 0xF8F0FFFFFFFFFFFFull, 0x0000000000000000ull, 0x00222A3E00000000ull,
+    0x0000000000000000ull, 0x8F87FFFFFFFFFFFFull, 0x1F17FFFFFFFFFFFFull, 0x3F37FFFFFFFFFFFFull,
+    0xFFF7FFFFFFFFFCFCull, 0xFFF7FFFFFFFFF8F8ull, 0xFFF7FFFFFFFFF1F1ull, 0xFFF7FFFFFFFFE3E3ull,
+    0xFFF7FFFFFFFFC7C7ull, 0xFFF7FFFFFFFF8F8Full, 0xFFF7FFFFFFFF1F1Full, 0xFFF7FFFFFFFF3F3Full,
+    0xFFF7FFFFFFFCFCFCull, 0xFFF7FFFFFFF8F8F8ull, 0xFFF7FFFFFFF1F1F1ull, 0xFFF7FFFFFFE3E3E3ull,
+    0xFFF7FFFFFFC7C7C7ull, 0xFFF7FFFFFF8F8F8Full, 0xFFF7FFFFFF1F1F1Full, 0xFFF7FFFFFF3F3F3Full,
+    0xFFF7FFFFFCFCFCFFull, 0xFFF7FFFFF8F8F8FFull, 0xFFF7FFFFF1F1F1FFull, 0xFFF7FFFFE3E3E3FFull,
+    0xFFF7FFFFC7C7C7FFull, 0xFFF7FFFF8F8F8FFFull, 0xFFF7FFFF1F1F1FFFull, 0xFFF7FFFF3F3F3FFFull,
+    0xFFF7FFFCFCFCFFFFull, 0xFFF7FFF8F8F8FFFFull, 0xFFF7FFF1F1F1FFFFull, 0xFFF7FFE3E3E3FFFFull,
+    0xFFF7FFC7C7C7FFFFull, 0xFFF7FF8F8F8FFFFFull, 0xFFF7FF1F1F1FFFFFull, 0xFFF7FF3F3F3FFFFFull,
+    0xFFF7FCFCFCFFFFFFull, 0xFFF7F8F8F8FFFFFFull, 0xFFF7F1F1F1FFFFFFull, 0xFFF7E3E3E3FFFFFFull,
+    0xFFF7C7C7C7FFFFFFull, 0xFFF78F8F8FFFFFFFull, 0xFFF71F1F1FFFFFFFull, 0xFFF73F3F3FFFFFFFull,
+    0xFFF4FCFCFFFFFFFFull, 0x3E30380000000000ull, 0x1C10100000000000ull, 0x1C00000000000000ull,
+    0x1C04040000000000ull, 0x3E060E0000000000ull, 0xFF171F1FFFFFFFFFull, 0xFF373F3FFFFFFFFFull,
+    0xFCF4FCFFFFFFFFFFull, 0x3830380000000000ull, 0x1010000000000000ull, 0x0000000000000000ull,
+    0x0404000000000000ull, 0x0E060E0000000000ull, 0x1F171FFFFFFFFFFFull, 0x3F373FFFFFFFFFFFull,
+    0xFCF4FFFFFFFFFFFFull, 0x38303E0000000000ull, 0x1010080000000000ull, 0x0000140000000000ull,
+    0x0404080000000000ull, 0x0E063E0000000000ull, 0x1F17FFFFFFFFFFFFull, 0x3F37FFFFFFFFFFFFull,
+};
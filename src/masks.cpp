@@ -18,136 +18,174 @@
 
 #include <cassert>
 #include <cstdint>
-#include <cstdlib>
 
-#include "attacks.h"
 #include "bitboards.h"
 #include "masks.h"
 #include "types.h"
 
-int DistanceBetween[SQUARE_NB][SQUARE_NB];
-int KingPawnFileDistance[FILE_NB][1 << FILE_NB];
-uint64_t BitsBetweenMasks[SQUARE_NB][SQUARE_NB];
-uint64_t KingAreaMasks[COLOUR_NB][SQUARE_NB];
-uint64_t ForwardRanksMasks[COLOUR_NB][RANK_NB];
-uint64_t ForwardFileMasks[COLOUR_NB][SQUARE_NB];
-uint64_t AdjacentFilesMasks[FILE_NB];
-uint64_t PassedPawnMasks[COLOUR_NB][SQUARE_NB];
-uint64_t PawnConnectedMasks[COLOUR_NB][SQUARE_NB];
-uint64_t OutpostSquareMasks[COLOUR_NB][SQUARE_NB];
-uint64_t OutpostRanksMasks[COLOUR_NB];
+namespace {
+
+// The masks are built at compile time, in the same manner as the attack
+// tables. The attack lookups in attacks.cpp are not constexpr, so the few
+// leaper and slider sets needed here are computed directly
+
+struct MaskTables {
+    int distanceBetween[SQUARE_NB][SQUARE_NB];
+    int kingPawnFileDistance[FILE_NB][1 << FILE_NB];
+    uint64_t bitsBetweenMasks[SQUARE_NB][SQUARE_NB];
+    uint64_t kingAreaMasks[COLOUR_NB][SQUARE_NB];
+    uint64_t forwardRanksMasks[COLOUR_NB][RANK_NB];
+    uint64_t forwardFileMasks[COLOUR_NB][SQUARE_NB];
+    uint64_t adjacentFilesMasks[FILE_NB];
+    uint64_t passedPawnMasks[COLOUR_NB][SQUARE_NB];
+    uint64_t pawnConnectedMasks[COLOUR_NB][SQUARE_NB];
+    uint64_t outpostSquareMasks[COLOUR_NB][SQUARE_NB];
+    uint64_t outpostRanksMasks[COLOUR_NB];
+};
+
+constexpr int absolute(int value) {
+    return value < 0 ? -value : value;
+}
+
+constexpr uint64_t fileMask(int file) {
+    return uint64_t(FILE_A) << file;
+}
+
+constexpr uint64_t rankMask(int rank) {
+    return uint64_t(RANK_1) << (8 * rank);
+}
+
+constexpr uint64_t kingStep(int sq) {
+    const uint64_t bb = 1ull << sq;
+    const uint64_t row = bb | ((bb << 1) & ~uint64_t(FILE_A)) | ((bb >> 1) & ~uint64_t(FILE_H));
+    return (row | (row << 8) | (row >> 8)) ^ bb;
+}
+
+constexpr uint64_t pawnStep(int colour, int sq) {
+    const uint64_t bb = 1ull << sq;
+    const uint64_t row = ((bb << 1) & ~uint64_t(FILE_A)) | ((bb >> 1) & ~uint64_t(FILE_H));
+    return colour == WHITE ? row << 8 : row >> 8;
+}
 
-void initMasks() {
+constexpr MaskTables buildMaskTables() {
+
+    const int RayDelta[8][2] = {{ 1,-1}, { 1, 1}, { 1, 0}, { 0, 1}, {-1,-1}, {-1, 1}, {-1, 0}, { 0,-1}};
+
+    MaskTables tables = {};
 
     // Init a table for the distance between two given squares
     for (int sq1 = 0; sq1 < SQUARE_NB; ++sq1)
         for (int sq2 = 0; sq2 < SQUARE_NB; ++sq2)
-            DistanceBetween[sq1][sq2] = MAX(abs(fileOf(sq1)-fileOf(sq2)), abs(rankOf(sq1)-rankOf(sq2)));
+            tables.distanceBetween[sq1][sq2] = MAX(absolute(fileOf(sq1)-fileOf(sq2)), absolute(rankOf(sq1)-rankOf(sq2)));
 
     // Init a table to compute the distance between Pawns and Kings file-wise
     for (uint64_t mask = 0ull; mask <= 0xFF; ++mask) {
         for (int file = 0; file < FILE_NB; ++file) {
 
-            int ldist, rdist, dist;
-            uint64_t left, right;
-
             // Look at only one side at a time by shifting off the other pawns
-            left  = (0xFFull & (mask << (FILE_NB - file - 1))) >> (FILE_NB - file - 1);
-            right = (mask >> file) << file;
+            const uint64_t left  = (0xFFull & (mask << (FILE_NB - file - 1))) >> (FILE_NB - file - 1);
+            const uint64_t right = (mask >> file) << file;
 
             // Find closest Pawn on each side. If no pawn, use "max" distance
-            ldist = left  ? file - getmsb(left)  : FILE_NB-1;
-            rdist = right ? getlsb(right) - file : FILE_NB-1;
+            const int ldist = left  ? file - getmsb(left)  : FILE_NB-1;
+            const int rdist = right ? getlsb(right) - file : FILE_NB-1;
 
             // Take the min distance, unless there are no pawns, then use 0
-            dist = (left | right) ? MIN(ldist, rdist) : 0;
-            KingPawnFileDistance[file][mask] = dist;
+            tables.kingPawnFileDistance[file][mask] = (left | right) ? MIN(ldist, rdist) : 0;
         }
     }
 
-    // Init a table of bitmasks for the squares between two given ones (aligned on diagonal)
-    for (int sq1 = 0; sq1 < SQUARE_NB; ++sq1)
-        for (int sq2 = 0; sq2 < SQUARE_NB; ++sq2)
-            if (testBit(bishopAttacks(sq1, 0ull), sq2))
-                BitsBetweenMasks[sq1][sq2] = bishopAttacks(sq1, 1ull << sq2)
-                                           & bishopAttacks(sq2, 1ull << sq1);
+    // Init a table of bitmasks for the squares between two given ones (aligned on
+    // a diagonal or a straight), by walking outwards from the first square
+    for (int sq1 = 0; sq1 < SQUARE_NB; ++sq1) {
+        for (int dir = 0; dir < 8; ++dir) {
 
-    // Init a table of bitmasks for the squares between two given ones (aligned on a straight)
-    for (int sq1 = 0; sq1 < SQUARE_NB; ++sq1)
-        for (int sq2 = 0; sq2 < SQUARE_NB; ++sq2)
-            if (testBit(rookAttacks(sq1, 0ull), sq2))
-                BitsBetweenMasks[sq1][sq2] = rookAttacks(sq1, 1ull << sq2)
-                                           & rookAttacks(sq2, 1ull << sq1);
+            uint64_t between = 0ull;
+            int rank = rankOf(sq1) + RayDelta[dir][0], file = fileOf(sq1) + RayDelta[dir][1];
+
+            for (; 0 <= rank && rank < RANK_NB && 0 <= file && file < FILE_NB;
+                   rank += RayDelta[dir][0], file += RayDelta[dir][1]) {
+                tables.bitsBetweenMasks[sq1][square(rank, file)] = between;
+                between |= 1ull << square(rank, file);
+            }
+        }
+    }
 
     // Init a table for the King Areas. Use the King's square, the King's target
     // squares, and the squares within the pawn shield. When on the A/H files, extend
     // the King Area to include an additional file, namely the C and F file respectively
     for (int sq = 0; sq < SQUARE_NB; ++sq) {
 
-        KingAreaMasks[WHITE][sq] = kingAttacks(sq) | (1ull << sq) | (kingAttacks(sq) << 8);
-        KingAreaMasks[BLACK][sq] = kingAttacks(sq) | (1ull << sq) | (kingAttacks(sq) >> 8);
+        tables.kingAreaMasks[WHITE][sq] = kingStep(sq) | (1ull << sq) | (kingStep(sq) << 8);
+        tables.kingAreaMasks[BLACK][sq] = kingStep(sq) | (1ull << sq) | (kingStep(sq) >> 8);
 
-        KingAreaMasks[WHITE][sq] |= fileOf(sq) != 0 ? 0ull : KingAreaMasks[WHITE][sq] << 1;
-        KingAreaMasks[BLACK][sq] |= fileOf(sq) != 0 ? 0ull : KingAreaMasks[BLACK][sq] << 1;
+        tables.kingAreaMasks[WHITE][sq] |= fileOf(sq) != 0 ? 0ull : tables.kingAreaMasks[WHITE][sq] << 1;
+        tables.kingAreaMasks[BLACK][sq] |= fileOf(sq) != 0 ? 0ull : tables.kingAreaMasks[BLACK][sq] << 1;
 
-        KingAreaMasks[WHITE][sq] |= fileOf(sq) != 7 ? 0ull : KingAreaMasks[WHITE][sq] >> 1;
-        KingAreaMasks[BLACK][sq] |= fileOf(sq) != 7 ? 0ull : KingAreaMasks[BLACK][sq] >> 1;
+        tables.kingAreaMasks[WHITE][sq] |= fileOf(sq) != 7 ? 0ull : tables.kingAreaMasks[WHITE][sq] >> 1;
+        tables.kingAreaMasks[BLACK][sq] |= fileOf(sq) != 7 ? 0ull : tables.kingAreaMasks[BLACK][sq] >> 1;
     }
 
     // Init a table of bitmasks for the ranks at or above a given rank, by colour
     for (int rank = 0; rank < RANK_NB; ++rank) {
         for (int i = rank; i < RANK_NB; ++i)
-            ForwardRanksMasks[WHITE][rank] |= Ranks[i];
-        ForwardRanksMasks[BLACK][rank] = ~ForwardRanksMasks[WHITE][rank] | Ranks[rank];
+            tables.forwardRanksMasks[WHITE][rank] |= rankMask(i);
+        tables.forwardRanksMasks[BLACK][rank] = ~tables.forwardRanksMasks[WHITE][rank] | rankMask(rank);
     }
 
     // Init a table of bitmasks for the squares on a file above a given square, by colour
     for (int sq = 0; sq < SQUARE_NB; ++sq) {
-        ForwardFileMasks[WHITE][sq] = Files[fileOf(sq)] & ForwardRanksMasks[WHITE][rankOf(sq)];
-        ForwardFileMasks[BLACK][sq] = Files[fileOf(sq)] & ForwardRanksMasks[BLACK][rankOf(sq)];
+        tables.forwardFileMasks[WHITE][sq] = fileMask(fileOf(sq)) & tables.forwardRanksMasks[WHITE][rankOf(sq)];
+        tables.forwardFileMasks[BLACK][sq] = fileMask(fileOf(sq)) & tables.forwardRanksMasks[BLACK][rankOf(sq)];
     }
 
     // Init a table of bitmasks containing the files next to a given file
     for (int file = 0; file < FILE_NB; ++file) {
-        AdjacentFilesMasks[file]  = Files[MAX(0, file-1)];
-        AdjacentFilesMasks[file] |= Files[MIN(FILE_NB-1, file+1)];
-        AdjacentFilesMasks[file] &= ~Files[file];
+        tables.adjacentFilesMasks[file]  = fileMask(MAX(0, file-1));
+        tables.adjacentFilesMasks[file] |= fileMask(MIN(FILE_NB-1, file+1));
+        tables.adjacentFilesMasks[file] &= ~fileMask(file);
     }
 
     // Init a table of bitmasks to check if a given pawn has any opposition
     for (int colour = WHITE; colour <= BLACK; ++colour)
         for (int sq = 0; sq < SQUARE_NB; ++sq)
-            PassedPawnMasks[colour][sq] = ~forwardRanksMasks(!colour, rankOf(sq))
-                                        & (adjacentFilesMasks(fileOf(sq)) | Files[fileOf(sq)]);
+            tables.passedPawnMasks[colour][sq] = ~tables.forwardRanksMasks[!colour][rankOf(sq)]
+                                               & (tables.adjacentFilesMasks[fileOf(sq)] | fileMask(fileOf(sq)));
 
     // Init a table of bitmasks to check if a square is an outpost relative
     // to opposing pawns, such that no enemy pawn may attack the square with ease
     for (int colour = WHITE; colour <= BLACK; ++colour)
         for (int sq = 0; sq < SQUARE_NB; ++sq)
-            OutpostSquareMasks[colour][sq] = PassedPawnMasks[colour][sq] & ~Files[fileOf(sq)];
+            tables.outpostSquareMasks[colour][sq] = tables.passedPawnMasks[colour][sq] & ~fileMask(fileOf(sq));
 
     // Init a pair of bitmasks to check if a square may be an outpost, by colour
-    OutpostRanksMasks[WHITE] = RANK_4 | RANK_5 | RANK_6;
-    OutpostRanksMasks[BLACK] = RANK_3 | RANK_4 | RANK_5;
+    tables.outpostRanksMasks[WHITE] = RANK_4 | RANK_5 | RANK_6;
+    tables.outpostRanksMasks[BLACK] = RANK_3 | RANK_4 | RANK_5;
 
     // Init a table of bitmasks to check for supports for a given pawn
     for (int sq = 8 ; sq < 56; ++sq) {
-        PawnConnectedMasks[WHITE][sq] = pawnAttacks(BLACK, sq) | pawnAttacks(BLACK, sq + 8);
-        PawnConnectedMasks[BLACK][sq] = pawnAttacks(WHITE, sq) | pawnAttacks(WHITE, sq - 8);
+        tables.pawnConnectedMasks[WHITE][sq] = pawnStep(BLACK, sq) | pawnStep(BLACK, sq + 8);
+        tables.pawnConnectedMasks[BLACK][sq] = pawnStep(WHITE, sq) | pawnStep(WHITE, sq - 8);
     }
+
+    return tables;
+}
+
+constexpr MaskTables Masks = buildMaskTables();
+
 }
 
 int distanceBetween(int s1, int s2) {
     assert(0 <= s1 && s1 < SQUARE_NB);
     assert(0 <= s2 && s2 < SQUARE_NB);
-    return DistanceBetween[s1][s2];
+    return Masks.distanceBetween[s1][s2];
 }
 
 int kingPawnFileDistance(uint64_t pawns, int ksq) {
     pawns |= pawns >> 8; pawns |= pawns >> 16; pawns |= pawns >> 32;
     assert(0 <= fileOf(ksq) && fileOf(ksq) < FILE_NB);
     assert((pawns & 0xFF) < (1ull << FILE_NB));
-    return KingPawnFileDistance[fileOf(ksq)][pawns & 0xFF];
+    return Masks.kingPawnFileDistance[fileOf(ksq)][pawns & 0xFF];
 }
 
 int openFileCount(uint64_t pawns) {
@@ -158,51 +196,51 @@ int openFileCount(uint64_t pawns) {
 uint64_t bitsBetweenMasks(int s1, int s2) {
     assert(0 <= s1 && s1 < SQUARE_NB);
     assert(0 <= s2 && s2 < SQUARE_NB);
-    return BitsBetweenMasks[s1][s2];
+    return Masks.bitsBetweenMasks[s1][s2];
 }
 
 uint64_t kingAreaMasks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
-    return KingAreaMasks[colour][sq];
+    return Masks.kingAreaMasks[colour][sq];
 }
 
 uint64_t forwardRanksMasks(int colour, int rank) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= rank && rank < RANK_NB);
-    return ForwardRanksMasks[colour][rank];
+    return Masks.forwardRanksMasks[colour][rank];
 }
 
 uint64_t forwardFileMasks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
-    return ForwardFileMasks[colour][sq];
+    return Masks.forwardFileMasks[colour][sq];
 }
 
 uint64_t adjacentFilesMasks(int file) {
     assert(0 <= file && file < FILE_NB);
-    return AdjacentFilesMasks[file];
+    return Masks.adjacentFilesMasks[file];
 }
 
 uint64_t passedPawnMasks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
-    return PassedPawnMasks[colour][sq];
+    return Masks.passedPawnMasks[colour][sq];
 }
 
 uint64_t pawnConnectedMasks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
-    return PawnConnectedMasks[colour][sq];
+    return Masks.pawnConnectedMasks[colour][sq];
 }
 
 uint64_t outpostSquareMasks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
-    return OutpostSquareMasks[colour][sq];
+    return Masks.outpostSquareMasks[colour][sq];
 }
 
 uint64_t outpostRanksMasks(int colour) {
     assert(0 <= colour && colour < COLOUR_NB);
-    return OutpostRanksMasks[colour];
+    return Masks.outpostRanksMasks[colour];
 }
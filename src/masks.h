@@ -22,8 +22,6 @@
 
 #include "types.h"
 
-void initMasks();
-
 int distanceBetween(int sq1, int sq2);
 int kingPawnFileDistance(uint64_t pawns, int ksq);
 int openFileCount(uint64_t pawns);
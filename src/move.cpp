@@ -19,6 +19,7 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 #include "attacks.h"
 #include "bitboards.h"
@@ -38,6 +39,27 @@ static void updateCastleZobrist(Board& board, uint64_t oldRooks, uint64_t newRoo
 		board.hash ^= ZobristCastleKeys[poplsb(diff)];
 }
 
+#ifdef USE_ATTACK_MAPS
+
+static uint64_t squaresChangedBy(Board& board, uint16_t move) {
+
+	const int from = MoveFrom(move);
+	const int to = MoveTo(move);
+
+	if (MoveType(move) == CASTLE_MOVE)
+		return (1ull << from) | (1ull << to)
+			 | (1ull << castleKingTo(from, to))
+			 | (1ull << castleRookTo(from, to));
+
+	if (MoveType(move) == ENPASS_MOVE)
+		return (1ull << from) | (1ull << to)
+			 | (1ull << (to - 8 + (board.turn << 4)));
+
+	return (1ull << from) | (1ull << to);
+}
+
+#endif
+
 int castleKingTo(int king, int rook) {
 	return square(rankOf(king), (rook > king) ? 6 : 2);
 }
@@ -48,6 +70,10 @@ int castleRookTo(int king, int rook) {
 
 int apply(Thread *thread, Board& board, uint16_t move, int height) {
 
+	// Store hash history for repetition checking
+	assert(board.numMoves < thread->repetitions.capacity);
+	thread->repetitions.keys[board.numMoves] = board.hash;
+
 	// nullptr moves are only tried when legal
 	if (move == NULL_MOVE) {
 		thread->moveStack[height] = NULL_MOVE;
@@ -59,16 +85,22 @@ int apply(Thread *thread, Board& board, uint16_t move, int height) {
 	thread->moveStack[height] = move;
 	thread->pieceStack[height] = pieceType(board.squares[MoveFrom(move)]);
 
-	// Apply the move and reject if illegal
+	// Reject illegal moves before ever making them
+	if (!moveIsLegal(board, move))
+		return 0;
+
 	applyMove(board, move, thread->undoStack[height]);
-	if (!moveWasLegal(board))
-		return revertMove(board, move, thread->undoStack[height]), 0;
+	assert(moveWasLegal(board));
 
 	return 1;
 }
 
 void applyLegal(Thread *thread, Board& board, uint16_t move, int height) {
 
+	// Store hash history for repetition checking
+	assert(board.numMoves < thread->repetitions.capacity);
+	thread->repetitions.keys[board.numMoves] = board.hash;
+
 	// Track some move information for history lookups
 	thread->moveStack[height] = move;
 	thread->pieceStack[height] = pieceType(board.squares[MoveFrom(move)]);
@@ -85,17 +117,33 @@ void applyMove(Board& board, uint16_t move, Undo& undo) {
 		applyEnpassMove, applyPromotionMove
 	};
 
+#ifdef USE_COPY_MAKE
+	// Save the entire state, so that reverting is a single copy
+	static_cast<BoardState&>(undo) = board;
+#else
 	// Save information which is hard to recompute
 	undo.hash            = board.hash;
 	undo.pkhash          = board.pkhash;
+	undo.materialKey     = board.materialKey;
 	undo.kingAttackers   = board.kingAttackers;
+	undo.pinned          = board.pinned;
 	undo.castleRooks     = board.castleRooks;
 	undo.epSquare        = board.epSquare;
 	undo.halfMoveCounter = board.halfMoveCounter;
 	undo.psqtmat         = board.psqtmat;
-
-	// Store hash history for repetition checking
-	board.history[board.numMoves++] = board.hash;
+#endif
+
+#ifdef USE_ATTACK_MAPS
+	// Lift the attacks of every piece the move affects before making it
+#ifndef USE_COPY_MAKE
+	memcpy(undo.attackMaps, board.attackMaps, sizeof(board.attackMaps));
+#endif
+	uint64_t changed = squaresChangedBy(board, move);
+	uint64_t lifted  = liftAttackMaps(board, changed);
+#endif
+
+	// The key was recorded by the caller, if it checks for repetitions
+	board.numMoves++;
 	board.fullMoveCounter++;
 
 	// Update the hash for before changing the enpass square
@@ -112,8 +160,14 @@ void applyMove(Board& board, uint16_t move, Undo& undo) {
 	// No function updates this so we do it here
 	board.turn = !board.turn;
 
-	// Need king attackers to verify move legality
+#ifdef USE_ATTACK_MAPS
+	dropAttackMaps(board, changed, lifted);
+	assert(attackMapsAreValid(board));
+#endif
+
+	// Need king attackers and pins to verify move legality
 	board.kingAttackers = attackersToKingSquare(board);
+	board.pinned = pinnedPieces(board, board.turn);
 }
 
 void applyNormalMove(Board& board, uint16_t move, Undo& undo) {
@@ -143,14 +197,18 @@ void applyNormalMove(Board& board, uint16_t move, Undo& undo) {
 	board.squares[to]   = fromPiece;
 	undo.capturePiece   = toPiece;
 
-	board.castleRooks &= board.castleMasks[from];
-	board.castleRooks &= board.castleMasks[to];
+	// Moving or capturing a castling Rook loses the rights with that Rook.
+	// Moving the King loses all of ours, which sit on our back rank
+	board.castleRooks &= ~((1ull << from) | (1ull << to));
+	if (fromType == KING) board.castleRooks &= ~(board.turn == WHITE ? RANK_1 : RANK_8);
 	updateCastleZobrist(board, undo.castleRooks, board.castleRooks);
 
 	board.psqtmat += PSQT[fromPiece][to]
 						-  PSQT[fromPiece][from]
 						-  PSQT[toPiece][to];
 
+	board.materialKey -= MaterialKeys[toPiece];
+
 	board.hash    ^= ZobristKeys[fromPiece][from]
 						^  ZobristKeys[fromPiece][to]
 						^  ZobristKeys[toPiece][to]
@@ -201,7 +259,7 @@ void applyCastleMove(Board& board, uint16_t move, Undo& undo) {
 	board.squares[to]    = fromPiece;
 	board.squares[rTo]   = rFromPiece;
 
-	board.castleRooks &= board.castleMasks[from];
+	board.castleRooks &= ~(board.turn == WHITE ? RANK_1 : RANK_8);
 	updateCastleZobrist(board, undo.castleRooks, board.castleRooks);
 
 	board.psqtmat += PSQT[fromPiece][to]
@@ -249,6 +307,8 @@ void applyEnpassMove(Board& board, uint16_t move, Undo& undo) {
 						-  PSQT[fromPiece][from]
 						-  PSQT[enpassPiece][ep];
 
+	board.materialKey -= MaterialKeys[enpassPiece];
+
 	board.hash    ^= ZobristKeys[fromPiece][from]
 						^  ZobristKeys[fromPiece][to]
 						^  ZobristKeys[enpassPiece][ep]
@@ -288,13 +348,17 @@ void applyPromotionMove(Board& board, uint16_t move, Undo& undo) {
 	board.squares[to]   = promoPiece;
 	undo.capturePiece   = toPiece;
 
-	board.castleRooks &= board.castleMasks[to];
+	board.castleRooks &= ~(1ull << to);
 	updateCastleZobrist(board, undo.castleRooks, board.castleRooks);
 
 	board.psqtmat += PSQT[promoPiece][to]
 						-  PSQT[fromPiece][from]
 						-  PSQT[toPiece][to];
 
+	board.materialKey += MaterialKeys[promoPiece]
+						-  MaterialKeys[fromPiece]
+						-  MaterialKeys[toPiece];
+
 	board.hash    ^= ZobristKeys[fromPiece][from]
 						^  ZobristKeys[promoPiece][to]
 						^  ZobristKeys[toPiece][to]
@@ -309,15 +373,22 @@ void applyPromotionMove(Board& board, uint16_t move, Undo& undo) {
 
 void applyNullMove(Board& board, Undo& undo) {
 
+#ifdef USE_COPY_MAKE
+	static_cast<BoardState&>(undo) = board;
+	board.halfMoveCounter++;
+#else
 	// Save information which is hard to recompute
 	// Some information is certain to stay the same
 	undo.hash            = board.hash;
+	undo.pinned          = board.pinned;
 	undo.epSquare        = board.epSquare;
 	undo.halfMoveCounter = board.halfMoveCounter++;
+#endif
 
 	// nullptr moves simply swap the turn only
 	board.turn = !board.turn;
-	board.history[board.numMoves++] = board.hash;
+	board.pinned = pinnedPieces(board, board.turn);
+	board.numMoves++;
 	board.fullMoveCounter++;
 
 	// Update the hash for turn and changes to enpass square
@@ -335,18 +406,28 @@ void revert(Thread *thread, Board& board, uint16_t move, int height) {
 
 void revertMove(Board& board, uint16_t move, Undo& undo) {
 
+#ifdef USE_COPY_MAKE
+	(void) move;
+	static_cast<BoardState&>(board) = undo;
+#else
 	const int to = MoveTo(move);
 	const int from = MoveFrom(move);
 
 	// Revert information which is hard to recompute
 	board.hash            = undo.hash;
 	board.pkhash          = undo.pkhash;
+	board.materialKey     = undo.materialKey;
 	board.kingAttackers   = undo.kingAttackers;
+	board.pinned          = undo.pinned;
 	board.castleRooks     = undo.castleRooks;
 	board.epSquare        = undo.epSquare;
 	board.halfMoveCounter = undo.halfMoveCounter;
 	board.psqtmat         = undo.psqtmat;
 
+#ifdef USE_ATTACK_MAPS
+	memcpy(board.attackMaps, undo.attackMaps, sizeof(board.attackMaps));
+#endif
+
 	// Swap turns and update the history index
 	board.turn = !board.turn;
 	board.numMoves--;
@@ -420,20 +501,30 @@ void revertMove(Board& board, uint16_t move, Undo& undo) {
 		board.squares[to] = EMPTY;
 		board.squares[ep] = undo.capturePiece;
 	}
+#endif
+
+#ifdef USE_ATTACK_MAPS
+	assert(attackMapsAreValid(board));
+#endif
 }
 
 void revertNullMove(Board& board, Undo& undo) {
 
+#ifdef USE_COPY_MAKE
+	static_cast<BoardState&>(board) = undo;
+#else
 	// Revert information which is hard to recompute
 	// We may, and have to, zero out the king attacks
 	board.hash            = undo.hash;
 	board.kingAttackers   = 0ull;
+	board.pinned          = undo.pinned;
 	board.epSquare        = undo.epSquare;
 	board.halfMoveCounter = undo.halfMoveCounter;
 
 	// nullptr moves simply swap the turn only
 	board.turn = !board.turn;
 	board.numMoves--;
+#endif
 }
 
 int legalMoveCount(Board& board) {
@@ -520,6 +611,67 @@ int moveWasLegal(Board& board) {
 	return !squareIsAttacked(board, !board.turn, sq);
 }
 
+int moveIsLegal(Board& board, uint16_t move) {
+
+	// Decide the legality of a pseudo legal move without making it, by
+	// using the checkers and pinned pieces which are kept on the Board
+
+	const int from = MoveFrom(move);
+	const int to   = MoveTo(move);
+
+	uint64_t enemy    = board.colours[!board.turn];
+	uint64_t occupied = board.colours[WHITE] | board.colours[BLACK];
+	int king          = getlsb(board.colours[board.turn] & board.pieces[KING]);
+
+	// Castles are never generated while in check, and the squares the King
+	// passes through were verified, leaving only its destination to check
+	if (MoveType(move) == CASTLE_MOVE) {
+		int kingTo = castleKingTo(from, to), rookTo = castleRookTo(from, to);
+		occupied ^= (1ull << from) ^ (1ull << to);
+		occupied |= (1ull << kingTo) | (1ull << rookTo);
+		return !(allAttackersToSquare(board, occupied, kingTo) & enemy);
+	}
+
+	// King moves are legal if the destination is not attacked, once the King
+	// has been removed, so that it may not step backwards along a checking ray
+#ifdef USE_ATTACK_MAPS
+	if (from == king && !board.kingAttackers)
+		return !testBit(attackedSquares(board, !board.turn), to);
+#endif
+	if (from == king)
+		return !(allAttackersToSquare(board, occupied ^ (1ull << king), to) & enemy);
+
+	// Enpass removes two pieces from a single line at once. We look at the
+	// resulting occupancy, and ensure that nothing would attack our King
+	if (MoveType(move) == ENPASS_MOVE) {
+
+		const int captured = to - 8 + (board.turn << 4);
+		occupied ^= (1ull << from) ^ (1ull << to) ^ (1ull << captured);
+		enemy    ^= (1ull << captured);
+
+		return !(bishopAttacks(king, occupied) & enemy & (board.pieces[BISHOP] | board.pieces[QUEEN]))
+			&& !(rookAttacks(king, occupied) & enemy & (board.pieces[ROOK] | board.pieces[QUEEN]))
+			&& !(knightAttacks(king) & enemy & board.pieces[KNIGHT])
+			&& !(pawnAttacks(board.turn, king) & enemy & board.pieces[PAWN]);
+	}
+
+	// When in check, we must capture the single checker or block its path
+	if (board.kingAttackers) {
+
+		if (several(board.kingAttackers))
+			return 0;
+
+		int checker = getlsb(board.kingAttackers);
+		if (!testBit(board.kingAttackers | bitsBetweenMasks(king, checker), to))
+			return 0;
+	}
+
+	// Pinned pieces may only move along the line through our King
+	return !testBit(board.pinned, from)
+		||  testBit(bitsBetweenMasks(king, to), from)
+		||  testBit(bitsBetweenMasks(king, from), to);
+}
+
 int moveIsPseudoLegal(Board& board, uint16_t move) {
 
 	int from   = MoveFrom(move);
@@ -654,3 +806,44 @@ void moveToString(uint16_t move, char *str, int chess960) {
 		str[5] = '\0';
 	}
 }
+
+uint16_t stringToMove(Board& board, const char *str) {
+
+	// Decode a move in long algebraic notation, as sent over UCI, without
+	// generating any moves. The result is checked for pseudo legality and
+	// legality, so anything malformed or illegal is returned as NONE_MOVE
+
+	static const char *Promotions = "nbrq";
+	const char *promo;
+	char castleStr[6];
+
+	if (   str[0] < 'a' || str[0] > 'h' || str[1] < '1' || str[1] > '8'
+		|| str[2] < 'a' || str[2] > 'h' || str[3] < '1' || str[3] > '8')
+		return NONE_MOVE;
+
+	const int from = square(str[1] - '1', str[0] - 'a');
+	const int to   = square(str[3] - '1', str[2] - 'a');
+	const int type = pieceType(board.squares[from]);
+
+	uint16_t move = MoveMake(from, to, NORMAL_MOVE);
+
+	// Castles are written as the King taking its own Rook in FRC, and as the
+	// King moving two squares otherwise. Let moveToString() settle which
+	uint64_t castles = board.colours[board.turn] & board.castleRooks;
+	while (type == KING && castles) {
+		uint16_t castle = MoveMake(from, poplsb(castles), CASTLE_MOVE);
+		moveToString(castle, castleStr, board.chess960);
+		if (!strncmp(str, castleStr, 4)) { move = castle; break; }
+	}
+
+	if (type == PAWN && to == board.epSquare)
+		move = MoveMake(from, to, ENPASS_MOVE);
+
+	if (type == PAWN && str[4] && (promo = strchr(Promotions, str[4])))
+		move = MoveMake(from, to, PROMOTION_MOVE | ((promo - Promotions) << 14));
+
+	if (!moveIsPseudoLegal(board, move) || !moveIsLegal(board, move))
+		return NONE_MOVE;
+
+	return move;
+}
@@ -60,7 +60,9 @@ int moveEstimatedValue(Board& board, uint16_t move);
 int moveBestCaseValue(Board& board);
 int moveIsPseudoLegal(Board& board, uint16_t move);
 int moveWasLegal(Board& board);
+int moveIsLegal(Board& board, uint16_t move);
 void moveToString(uint16_t move, char *str, int chess960);
+uint16_t stringToMove(Board& board, const char *str);
 
 #define MoveFrom(move)         (((move) >> 0) & 63)
 #define MoveTo(move)           (((move) >> 6) & 63)
@@ -83,11 +83,33 @@ void buildKingMoves(uint16_t *moves, int& size, uint64_t pieces, uint64_t target
     int sq = getlsb(pieces);
     buildNonPawnMoves(moves, size, kingAttacks(sq) & targets, sq);
 }
+
+void buildLegalKingMoves(Board& board, uint16_t *moves, int& size, int king, uint64_t targets) {
+
+    // Remove the King from the occupancy, so that we see squares which are
+    // only attacked through the King itself, like the one behind it on a ray
+    uint64_t enemy    = board.colours[!board.turn];
+    uint64_t occupied = (board.colours[WHITE] | board.colours[BLACK]) ^ (1ull << king);
+    uint64_t attacks  = kingAttacks(king) & targets;
+
+#ifdef USE_ATTACK_MAPS
+    // Out of check no enemy ray runs through the King, so the maps are exact
+    if (!board.kingAttackers) {
+        buildNonPawnMoves(moves, size, attacks & ~attackedSquares(board, !board.turn), king);
+        return;
+    }
+#endif
+
+    while (attacks) {
+        int to = poplsb(attacks);
+        if (!(allAttackersToSquare(board, occupied, to) & enemy))
+            moves[size++] = MoveMake(king, to, NORMAL_MOVE);
+    }
+}
 }
 
 void genAllLegalMoves(Board& board, uint16_t *moves, int& size) {
 
-    Undo undo;
     int pseudoSize = 0;
     uint16_t pseudoMoves[MAX_MOVES];
 
@@ -96,11 +118,9 @@ void genAllLegalMoves(Board& board, uint16_t *moves, int& size) {
     genAllQuietMoves(board, pseudoMoves, pseudoSize);
 
     // Check each move for legality before copying
-    for (int i = 0; i < pseudoSize; ++i) {
-        applyMove(board, pseudoMoves[i], undo);
-        if (moveWasLegal(board)) moves[size++] = pseudoMoves[i];
-        revertMove(board, pseudoMoves[i], undo);
-    }
+    for (int i = 0; i < pseudoSize; ++i)
+        if (moveIsLegal(board, pseudoMoves[i]))
+            moves[size++] = pseudoMoves[i];
 }
 
 void genAllNoisyMoves(Board& board, uint16_t *moves, int& size) {
@@ -157,6 +177,103 @@ void genAllNoisyMoves(Board& board, uint16_t *moves, int& size) {
     buildKingMoves(moves, size, myKings, enemy);
 }
 
+void genAllNoisyEvasions(Board& board, uint16_t *moves, int& size) {
+
+    const int Forward = board.turn == WHITE ? -8 : 8;
+    const int Left    = board.turn == WHITE ? -7 : 7;
+    const int Right   = board.turn == WHITE ? -9 : 9;
+
+    uint64_t checkers, blocks, pawnEnpass, pawnLeft, pawnRight;
+    uint64_t pawnPromoForward, pawnPromoLeft, pawnPromoRight;
+
+    uint64_t friendly = board.colours[ board.turn];
+    uint64_t enemy    = board.colours[!board.turn];
+    uint64_t occupied = friendly | enemy;
+    int king          = getlsb(friendly & board.pieces[KING]);
+
+    // King captures, which may also take pieces other than the checker
+    buildLegalKingMoves(board, moves, size, king, enemy);
+
+    // Double checks can only be evaded by moving the King
+    if (several(board.kingAttackers)) return;
+
+    // Pinned pieces can never evade a check, since they would have to leave
+    // the line of the pin in order to capture the checker or block its path
+    friendly &= ~board.pinned;
+    checkers  = board.kingAttackers;
+    blocks    = bitsBetweenMasks(king, getlsb(checkers));
+
+    uint64_t myPawns   = friendly &  board.pieces[PAWN  ];
+    uint64_t myKnights = friendly &  board.pieces[KNIGHT];
+    uint64_t myBishops = friendly & (board.pieces[BISHOP] | board.pieces[QUEEN]);
+    uint64_t myRooks   = friendly & (board.pieces[ROOK  ] | board.pieces[QUEEN]);
+
+    // Pawns capture the checker, or promote on a square between it and our King
+    pawnEnpass       = pawnEnpassCaptures(myPawns, board.epSquare, board.turn);
+    pawnLeft         = pawnLeftAttacks(myPawns, checkers, board.turn);
+    pawnRight        = pawnRightAttacks(myPawns, checkers, board.turn);
+    pawnPromoForward = pawnAdvance(myPawns, occupied, board.turn) & PROMOTION_RANKS & blocks;
+    pawnPromoLeft    = pawnLeft & PROMOTION_RANKS; pawnLeft &= ~PROMOTION_RANKS;
+    pawnPromoRight   = pawnRight & PROMOTION_RANKS; pawnRight &= ~PROMOTION_RANKS;
+
+    while (pawnEnpass) {
+        uint16_t move = MoveMake(poplsb(pawnEnpass), board.epSquare, ENPASS_MOVE);
+        if (moveIsLegal(board, move)) moves[size++] = move;
+    }
+    buildPawnMoves(moves, size, pawnLeft, Left);
+    buildPawnMoves(moves, size, pawnRight, Right);
+    buildPawnPromotions(moves, size, pawnPromoForward, Forward);
+    buildPawnPromotions(moves, size, pawnPromoLeft, Left);
+    buildPawnPromotions(moves, size, pawnPromoRight, Right);
+
+    // Every other piece may only capture the checker
+    buildKnightMoves(moves, size, myKnights, checkers);
+    buildBishopMoves(moves, size, myBishops, occupied, checkers);
+    buildRookMoves(moves, size, myRooks, occupied, checkers);
+}
+
+void genAllQuietEvasions(Board& board, uint16_t *moves, int& size) {
+
+    const int Forward = board.turn == WHITE ? -8 : 8;
+    const uint64_t Rank3Relative = board.turn == WHITE ? RANK_3 : RANK_6;
+
+    uint64_t blocks, pawnForwardOne, pawnForwardTwo;
+
+    uint64_t friendly = board.colours[ board.turn];
+    uint64_t enemy    = board.colours[!board.turn];
+    uint64_t occupied = friendly | enemy;
+    int king          = getlsb(friendly & board.pieces[KING]);
+
+    // King steps onto squares which are not attacked
+    buildLegalKingMoves(board, moves, size, king, ~occupied);
+
+    // Double checks can only be evaded by moving the King
+    if (several(board.kingAttackers)) return;
+
+    // Only checks from a distance by a slider may be blocked
+    blocks = bitsBetweenMasks(king, getlsb(board.kingAttackers));
+    if (!blocks) return;
+
+    // Pinned pieces can never block a check (see genAllNoisyEvasions)
+    friendly &= ~board.pinned;
+
+    uint64_t myPawns   = friendly &  board.pieces[PAWN  ];
+    uint64_t myKnights = friendly &  board.pieces[KNIGHT];
+    uint64_t myBishops = friendly & (board.pieces[BISHOP] | board.pieces[QUEEN]);
+    uint64_t myRooks   = friendly & (board.pieces[ROOK  ] | board.pieces[QUEEN]);
+
+    // Compute bitboards for the quiet Pawn moves
+    pawnForwardOne = pawnAdvance(myPawns, occupied, board.turn) & ~PROMOTION_RANKS;
+    pawnForwardTwo = pawnAdvance(pawnForwardOne & Rank3Relative, occupied, board.turn);
+
+    // Generate all of the blocking moves
+    buildPawnMoves(moves, size, pawnForwardOne & blocks, Forward);
+    buildPawnMoves(moves, size, pawnForwardTwo & blocks, Forward * 2);
+    buildKnightMoves(moves, size, myKnights, blocks);
+    buildBishopMoves(moves, size, myBishops, occupied, blocks);
+    buildRookMoves(moves, size, myRooks, occupied, blocks);
+}
+
 void genAllQuietMoves(Board& board, uint16_t *moves, int& size) {
 
     const int Forward = board.turn == WHITE ? -8 : 8;
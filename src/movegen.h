@@ -25,3 +25,5 @@
 void genAllLegalMoves(Board& board, uint16_t *moves, int& size);
 void genAllNoisyMoves(Board& board, uint16_t *moves, int& size);
 void genAllQuietMoves(Board& board, uint16_t *moves, int& size);
+void genAllNoisyEvasions(Board& board, uint16_t *moves, int& size);
+void genAllQuietEvasions(Board& board, uint16_t *moves, int& size);
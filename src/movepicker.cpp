@@ -17,6 +17,7 @@
 */
 
 #include <cassert>
+#include <cstdio>
 
 #include "board.h"
 #include "history.h"
@@ -44,6 +45,32 @@ static int getBestMoveIndex(MovePicker& mp, int start, int end) {
     return best;
 }
 
+static void partialInsertionSort(uint16_t *moves, int *values, int length, int limit) {
+
+    // Sort the moves scoring at least the limit to the front of the list, in
+    // descending order. The rest are left behind them in no particular order,
+    // since they are rarely reached before a cutoff or before being pruned
+    for (int sorted = 0, i = 1; i < length; ++i) {
+
+        if (values[i] < limit)
+            continue;
+
+        const int value = values[i];
+        const uint16_t move = moves[i];
+
+        // Make room at the end of the sorted section
+        values[i] = values[++sorted];
+        moves[i] = moves[sorted];
+
+        // Shift lesser moves down until we find the slot for this one
+        int j = sorted;
+        for (; j > 0 && values[j-1] < value; --j)
+            values[j] = values[j-1], moves[j] = moves[j-1];
+
+        values[j] = value, moves[j] = move;
+    }
+}
+
 static void evaluateNoisyMoves(MovePicker& mp) {
 
     static const int MVVLVAValues[8] = {
@@ -68,13 +95,18 @@ static void evaluateNoisyMoves(MovePicker& mp) {
         else if ((mp.moves[i] & QUEEN_PROMO_MOVE) == QUEEN_PROMO_MOVE)
             mp.values[i] += MVVLVAValues[QUEEN];
 
+        // Adjust by the Capture History, which mostly reorders captures of
+        // similar value. Negative values are reserved to flag bad noisy moves
+        mp.values[i] += getCaptureHistory(mp.thread, mp.moves[i]) / CaptureHistoryDivisor;
+        mp.values[i]  = MAX(0, mp.values[i]);
+
         // We may flag a move with the value -1, to indicate that it was
         // designated as a bad noisy move while in STAGE_GENERATE_NOISY
         assert(mp.values[i] >= 0);
     }
 }
 
-void initMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height) {
+void initMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height, int depth) {
 
     // Start with the table move
     mp.stage = STAGE_TABLE;
@@ -87,14 +119,15 @@ void initMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height)
     mp.threshold = 0;
     mp.thread = thread;
     mp.height = height;
-    mp.type = NORMAL_PICKER;
+    mp.depth = depth;
+    mp.type = thread->board.kingAttackers ? EVASION_PICKER : NORMAL_PICKER;
 }
 
-void initSingularMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height) {
+void initSingularMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height, int depth) {
 
     // Simply skip over the TT move
-    initMovePicker(mp, thread, ttMove, height);
-    mp.stage = STAGE_GENERATE_NOISY;
+    initMovePicker(mp, thread, ttMove, height, depth);
+    mp.stage = mp.type == EVASION_PICKER ? STAGE_GENERATE_EVASIONS : STAGE_GENERATE_NOISY;
 
 }
 
@@ -109,7 +142,7 @@ void initNoisyMovePicker(MovePicker& mp, Thread *thread, int threshold) {
     // General housekeeping
     mp.threshold = threshold;
     mp.thread = thread;
-    mp.height = 0;
+    mp.height = mp.depth = 0;
     mp.type = NOISY_PICKER;
 }
 
@@ -122,10 +155,14 @@ uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets) {
         case STAGE_TABLE:
 
             // Play table move if it is pseudo legal
-            mp.stage = STAGE_GENERATE_NOISY;
+            mp.stage = mp.type == EVASION_PICKER ? STAGE_GENERATE_EVASIONS : STAGE_GENERATE_NOISY;
             if (moveIsPseudoLegal(board, mp.tableMove))
                 return mp.tableMove;
 
+            // Evasions are handled in their own stages below
+            if (mp.type == EVASION_PICKER)
+                return selectNextMove(mp, board, skipQuiets);
+
             /* fallthrough */
 
         case STAGE_GENERATE_NOISY:
@@ -152,9 +189,15 @@ uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets) {
                 // Values below zero are flagged as failing an SEE (bad noisy)
                 if (mp.values[best] >= 0) {
 
+                    // Outside of the Quiescence Search, relax the SEE margin for
+                    // moves which have a history of causing cutoffs, and vice versa
+                    int threshold = mp.threshold;
+                    if (mp.type == NORMAL_PICKER)
+                        threshold -= getCaptureHistory(mp.thread, mp.moves[best]) / CaptureHistoryDivisor;
+
                     // Skip moves which fail to beat our SEE margin. We flag those moves
                     // as failed with the value (-1), and then repeat the selection process
-                    if (!staticExchangeEvaluation(board, mp.moves[best], mp.threshold)) {
+                    if (!staticExchangeEvaluation(board, mp.moves[best], threshold)) {
                         mp.values[best] = -1;
                         return selectNextMove(mp, board, skipQuiets);
                     }
@@ -222,11 +265,14 @@ uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets) {
 
         case STAGE_GENERATE_QUIET:
 
-            // Generate and evaluate all quiet moves when not skipping them
+            // Generate and evaluate all quiet moves when not skipping them. Only
+            // the moves with a reasonable history are sorted, as the rest are
+            // rarely reached before a cutoff or the end of the search
             if (!skipQuiets) {
                 mp.quietSize = 0;
                 genAllQuietMoves(board, mp.moves + mp.split, mp.quietSize);
                 getHistoryScores(mp.thread, mp.moves, mp.values, mp.split, mp.quietSize, mp.height);
+                partialInsertionSort(mp.moves + mp.split, mp.values + mp.split, mp.quietSize, -QuietSortMargin * mp.depth);
             }
 
             mp.stage = STAGE_QUIET;
@@ -238,9 +284,10 @@ uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets) {
             // Check to see if there are still more quiet moves
             if (!skipQuiets && mp.quietSize) {
 
-                // Select next best quiet and reduce the effective move list size
-                best = getBestMoveIndex(mp, mp.split, mp.split + mp.quietSize) - mp.split;
-                bestMove = popMove(&mp.quietSize, mp.moves + mp.split, mp.values + mp.split, best);
+                // Quiets are already in order, so take them from the front by
+                // moving up the split. The noisy moves before it are unaffected
+                bestMove = mp.moves[mp.split++];
+                mp.quietSize--;
 
                 // Don't play a move more than once
                 if (   bestMove == mp.tableMove
@@ -282,9 +329,150 @@ uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets) {
         case STAGE_DONE:
             return NONE_MOVE;
 
+        case STAGE_GENERATE_EVASIONS:
+
+            // When in check we generate only legal evasions. The noisy moves
+            // are ordered by MVV-LVA, and placed before mp.split, while the quiet
+            // moves are ordered by their history scores and placed after it
+            mp.noisySize = mp.quietSize = 0;
+            genAllNoisyEvasions(board, mp.moves, mp.noisySize);
+            evaluateNoisyMoves(mp);
+            mp.split = mp.noisySize;
+            genAllQuietEvasions(board, mp.moves + mp.split, mp.quietSize);
+            getHistoryScores(mp.thread, mp.moves, mp.values, mp.split, mp.quietSize, mp.height);
+            mp.stage = STAGE_EVASIONS;
+
+            /* fallthrough */
+
+        case STAGE_EVASIONS:
+
+            // Captures and promotions first, since they will often resolve the
+            // check while winning material, followed by the quiet evasions
+            if (mp.noisySize) {
+                best = getBestMoveIndex(mp, 0, mp.noisySize);
+                bestMove = popMove(&mp.noisySize, mp.moves, mp.values, best);
+            }
+
+            else if (!skipQuiets && mp.quietSize) {
+                best = getBestMoveIndex(mp, mp.split, mp.split + mp.quietSize) - mp.split;
+                bestMove = popMove(&mp.quietSize, mp.moves + mp.split, mp.values + mp.split, best);
+            }
+
+            else {
+                mp.stage = STAGE_DONE;
+                return NONE_MOVE;
+            }
+
+            // Don't play the table move twice
+            if (bestMove == mp.tableMove)
+                return selectNextMove(mp, board, skipQuiets);
+
+            return bestMove;
+
         default:
             assert(0);
             return NONE_MOVE;
     }
 }
 
+#ifdef PICKER_STATS
+
+static int pickerDepthBucket(int depth) {
+    return depth <= 2 ? 0 : depth <= 4 ? 1 : depth <= 6 ? 2
+         : depth <= 8 ? 3 : depth <= 12 ? 4 : 5;
+}
+
+static int pickerMoveStage(MovePicker& mp) {
+
+    // After returning a move, selectNextMove() leaves the stage at the one
+    // which produced the move, or at the stage following it for those which
+    // produce no more than one move. Each stage is only left in one of those
+    // ways, so we can recover where the move came from without any overhead
+    switch (mp.stage) {
+        case STAGE_GENERATE_NOISY:     return STAGE_TABLE;
+        case STAGE_GENERATE_EVASIONS:  return STAGE_TABLE;
+        case STAGE_KILLER_2:           return STAGE_KILLER_1;
+        case STAGE_COUNTER_MOVE:       return STAGE_KILLER_2;
+        case STAGE_GENERATE_QUIET:     return STAGE_COUNTER_MOVE;
+        default:                       return mp.stage;
+    }
+}
+
+void recordPickerMove(PickerStats& stats, MovePicker& mp, int depth) {
+    stats.tried[pickerMoveStage(mp)][pickerDepthBucket(depth)]++;
+}
+
+void recordPickerNode(PickerStats& stats, MovePicker& mp, int depth, int played, int cutoff) {
+
+    const int bucket = pickerDepthBucket(depth);
+    const int stage  = pickerMoveStage(mp);
+
+    stats.nodes[bucket]++;
+
+    // The picker is left on the stage of the move which caused the cutoff
+    if (cutoff) {
+        stats.cutoffs[stage][bucket]++;
+        stats.firstCutoffs[stage][bucket] += played == 1;
+        stats.playedAtCutoffs[stage][bucket] += played;
+    }
+}
+
+void printPickerStats(Thread *threads) {
+
+    static const char *BucketNames[PICKER_DEPTH_BUCKETS] = {
+        "1-2", "3-4", "5-6", "7-8", "9-12", "13+"
+    };
+
+    static const char *StageNames[STAGE_NB] = {
+        "table", "", "good_noisy", "killer_1", "killer_2", "counter",
+        "", "quiet", "", "evasions", "bad_noisy", ""
+    };
+
+    PickerStats total = {};
+
+    // Combine the statistics from each Thread in the pool
+    for (int i = 0; i < threads->nthreads; ++i) {
+        for (int bucket = 0; bucket < PICKER_DEPTH_BUCKETS; ++bucket) {
+            total.nodes[bucket] += threads[i].pickerStats.nodes[bucket];
+            for (int stage = 0; stage < STAGE_NB; ++stage) {
+                total.tried[stage][bucket]           += threads[i].pickerStats.tried[stage][bucket];
+                total.cutoffs[stage][bucket]         += threads[i].pickerStats.cutoffs[stage][bucket];
+                total.firstCutoffs[stage][bucket]    += threads[i].pickerStats.firstCutoffs[stage][bucket];
+                total.playedAtCutoffs[stage][bucket] += threads[i].pickerStats.playedAtCutoffs[stage][bucket];
+            }
+        }
+    }
+
+    // The cutoff rate is the share of the moves tried from a stage which cut,
+    // the cutoff share is the share of all cutoffs at that depth from the stage,
+    // and the first move rate is the share of those cutoffs from the first move
+    printf("\ndepth,stage,nodes,tried,cutoffs,cutoff_rate,cutoff_share,first_move_cutoffs,first_move_rate,avg_played_at_cutoff\n");
+
+    for (int bucket = 0; bucket < PICKER_DEPTH_BUCKETS; ++bucket) {
+
+        uint64_t cutoffs = 0ull;
+        for (int stage = 0; stage < STAGE_NB; ++stage)
+            cutoffs += total.cutoffs[stage][bucket];
+
+        for (int stage = 0; stage < STAGE_NB; ++stage) {
+
+            const uint64_t tried = total.tried[stage][bucket];
+            const uint64_t cuts  = total.cutoffs[stage][bucket];
+            const uint64_t first = total.firstCutoffs[stage][bucket];
+
+            if (!*StageNames[stage]) continue;
+
+            printf("%s,%s,%llu,%llu,%llu,%.4f,%.4f,%llu,%.4f,%.2f\n",
+                BucketNames[bucket], StageNames[stage],
+                (unsigned long long)total.nodes[bucket],
+                (unsigned long long)tried, (unsigned long long)cuts,
+                tried   ? double(cuts) / tried   : 0.0,
+                cutoffs ? double(cuts) / cutoffs : 0.0,
+                (unsigned long long)first,
+                cuts    ? double(first) / cuts   : 0.0,
+                cuts    ? double(total.playedAtCutoffs[stage][bucket]) / cuts : 0.0);
+        }
+    }
+}
+
+#endif
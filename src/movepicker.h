@@ -20,27 +20,54 @@
 
 #include "types.h"
 
-enum { NORMAL_PICKER, NOISY_PICKER };
+enum { NORMAL_PICKER, NOISY_PICKER, EVASION_PICKER };
+
+// Quiets with a history score below -QuietSortMargin * depth are left unsorted
+static const int QuietSortMargin = 3000;
 
 enum {
     STAGE_TABLE,
     STAGE_GENERATE_NOISY, STAGE_GOOD_NOISY,
     STAGE_KILLER_1, STAGE_KILLER_2, STAGE_COUNTER_MOVE,
     STAGE_GENERATE_QUIET, STAGE_QUIET,
+    STAGE_GENERATE_EVASIONS, STAGE_EVASIONS,
     STAGE_BAD_NOISY,
-    STAGE_DONE,
+    STAGE_DONE, STAGE_NB
 };
 
 struct MovePicker {
     int split, noisySize, quietSize;
-    int stage, height, type, threshold;
+    int stage, height, depth, type, threshold;
     int values[MAX_MOVES];
     uint16_t moves[MAX_MOVES];
     uint16_t tableMove, killer1, killer2, counter;
     Thread *thread;
 };
 
-void initMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height);
-void initSingularMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height);
+void initMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height, int depth);
+void initSingularMovePicker(MovePicker& mp, Thread *thread, uint16_t ttMove, int height, int depth);
 void initNoisyMovePicker(MovePicker& mp, Thread *thread, int threshold);
 uint16_t selectNextMove(MovePicker& mp, Board& board, int skipQuiets);
+
+#ifdef PICKER_STATS
+
+// Built with MODE=STATS, the search records for each stage of the MovePicker
+// and for each bucket of depths, how many moves were searched, and how many
+// of those caused a cutoff, so that changes to the move ordering can be
+// compared by running bench, which prints the results as CSV
+
+enum { PICKER_DEPTH_BUCKETS = 6 };
+
+struct PickerStats {
+    uint64_t nodes[PICKER_DEPTH_BUCKETS];
+    uint64_t tried[STAGE_NB][PICKER_DEPTH_BUCKETS];
+    uint64_t cutoffs[STAGE_NB][PICKER_DEPTH_BUCKETS];
+    uint64_t firstCutoffs[STAGE_NB][PICKER_DEPTH_BUCKETS];
+    uint64_t playedAtCutoffs[STAGE_NB][PICKER_DEPTH_BUCKETS];
+};
+
+void recordPickerMove(PickerStats& stats, MovePicker& mp, int depth);
+void recordPickerNode(PickerStats& stats, MovePicker& mp, int depth, int played, int cutoff);
+void printPickerStats(Thread *threads);
+
+#endif
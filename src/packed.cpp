@@ -0,0 +1,283 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "board.h"
+#include "move.h"
+#include "packed.h"
+#include "types.h"
+
+int mapFile(const char *path, void *&buffer, size_t& bytes) {
+
+    buffer = nullptr, bytes = 0;
+
+#ifndef _WIN32
+
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (fd == -1) return 0;
+
+    if (fstat(fd, &st)) {
+        close(fd);
+        return 0;
+    }
+
+    // The mapping outlives the descriptor. Telling the OS that we read in
+    // order lets it read ahead, so that readers need not wait on the disk
+    if (st.st_size) {
+        buffer = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (buffer == MAP_FAILED) buffer = nullptr;
+        else posix_madvise(buffer, st.st_size, POSIX_MADV_SEQUENTIAL);
+    }
+
+    close(fd);
+
+    if (st.st_size && !buffer)
+        return 0;
+
+    bytes = st.st_size;
+
+#else
+
+    // Without mmap() we simply read the whole file into memory
+    FILE *fin = fopen(path, "rb");
+    if (fin == nullptr) return 0;
+
+    fseek(fin, 0, SEEK_END);
+    bytes  = ftell(fin);
+    buffer = malloc(bytes + 1);
+    fseek(fin, 0, SEEK_SET);
+
+    if (fread(buffer, 1, bytes, fin) != bytes) {
+        fclose(fin), free(buffer);
+        buffer = nullptr, bytes = 0;
+        return 0;
+    }
+
+    fclose(fin);
+
+#endif
+
+    return 1;
+}
+
+void unmapFile(void *buffer, size_t bytes) {
+
+#ifndef _WIN32
+    if (buffer) munmap(buffer, bytes);
+#else
+    (void)bytes, free(buffer);
+#endif
+}
+
+int openPackedFile(PackedFile& file, const char *path) {
+
+    file = PackedFile();
+
+    if (!mapFile(path, file.buffer, file.bytes))
+        return 0;
+
+    if (file.bytes % sizeof(PackedBoard)) {
+        closePackedFile(file);
+        return 0;
+    }
+
+    file.positions = (const PackedBoard*)file.buffer;
+    file.count     = file.bytes / sizeof(PackedBoard);
+    return 1;
+}
+
+void closePackedFile(PackedFile& file) {
+    unmapFile(file.buffer, file.bytes);
+    file = PackedFile();
+}
+
+int writePackedBoard(FILE *fout, Board& board, int score, int result, uint16_t move) {
+
+    PackedBoard packed;
+
+    packBoard(board, packed);
+    packed.score  = score;
+    packed.result = result;
+    packed.move   = move;
+
+    return fwrite(&packed, sizeof(PackedBoard), 1, fout) == 1;
+}
+
+void writePackedFEN(FILE *fout, const PackedBoard& packed) {
+
+    static const char *Results[] = { "0.0", "0.5", "1.0", "*" };
+
+    Board board;
+    string fen;
+    char moveStr[6];
+
+    // The line which fen2bin reads, followed by the move when there is one.
+    // A missing result is written as [*], as fen2bin finds the score after it
+    unpackBoard(board, packed, 0);
+    boardToFEN(board, fen);
+    fputs(fen.c_str(), fout);
+
+    if (packed.result != PACKED_NO_RESULT || packed.score != VALUE_NONE)
+        fprintf(fout, " [%s]", Results[MIN(int(packed.result), int(PACKED_NO_RESULT))]);
+
+    if (packed.score != VALUE_NONE)
+        fprintf(fout, " %d", board.turn == WHITE ? packed.score : -packed.score);
+
+    if (packed.move != NONE_MOVE) {
+        moveToString(packed.move, moveStr, board.chess960);
+        fprintf(fout, " %s", moveStr);
+    }
+
+    fputc('\n', fout);
+}
+
+int runPackFENs(int argc, char **argv) {
+
+    Board board;
+    char line[512];
+    uint64_t count = 0ull;
+
+    // Usage: fen2bin <input> <output>. Lines are read as the Texel Tuner reads
+    // them, "<fen> [<result>] <score>", where the score is for the side to move
+    // and the result for White, or * if unknown. Lines holding only a FEN are
+    // accepted as well
+    if (argc < 4) {
+        printf("Usage: fen2bin <input> <output>\n");
+        return 1;
+    }
+
+    FILE *fin  = fopen(argv[2], "r");
+    FILE *fout = fopen(argv[3], "wb");
+
+    if (fin == nullptr || fout == nullptr) {
+        printf("Unable to open %s\n", fin == nullptr ? argv[2] : argv[3]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), fin)) {
+
+        if (!strchr(line, '/')) continue;
+
+        boardFromFEN(board, line, 0);
+
+        const int result = strstr(line, "[1.0]") ? PACKED_WHITE_WIN
+                         : strstr(line, "[0.5]") ? PACKED_DRAW
+                         : strstr(line, "[0.0]") ? PACKED_BLACK_WIN : PACKED_NO_RESULT;
+
+        const char *scoreStr = strstr(line, "] ");
+        int score = scoreStr ? atoi(scoreStr + 2) : VALUE_NONE;
+        if (scoreStr && board.turn == BLACK) score = -score;
+
+        if (!writePackedBoard(fout, board, score, result, NONE_MOVE)) {
+            printf("Unable to write to %s\n", argv[3]);
+            return 1;
+        }
+
+        count++;
+    }
+
+    fclose(fin), fclose(fout);
+    printf("Packed %" PRIu64 " positions into %" PRIu64 " bytes\n", count, count * sizeof(PackedBoard));
+    return 0;
+}
+
+int runUnpackFENs(int argc, char **argv) {
+
+    PackedFile file;
+
+    // Usage: bin2fen <input> <output>. Writes the lines which fen2bin reads,
+    // followed by the move of each position when there is one
+    if (argc < 4) {
+        printf("Usage: bin2fen <input> <output>\n");
+        return 1;
+    }
+
+    if (!openPackedFile(file, argv[2])) {
+        printf("Unable to open %s, or its size is not a multiple of %d\n", argv[2], int(sizeof(PackedBoard)));
+        return 1;
+    }
+
+    FILE *fout = fopen(argv[3], "w");
+    if (fout == nullptr) {
+        printf("Unable to open %s\n", argv[3]);
+        return 1;
+    }
+
+    for (uint64_t i = 0; i < file.count; ++i)
+        writePackedFEN(fout, file.positions[i]);
+
+    fclose(fout);
+    printf("Unpacked %" PRIu64 " positions\n", file.count);
+    closePackedFile(file);
+    return 0;
+}
+
+void runPackedBenchmark(int argc, char **argv) {
+
+    using namespace std::chrono;
+
+    Board board;
+    PackedFile file;
+    uint64_t checksum = 0ull;
+    double seconds[2];
+
+    // Usage: binbench <file>. First we only touch each position, which is as
+    // fast as the data arrives, and then we unpack each into a Board as well
+    if (argc < 3 || !openPackedFile(file, argv[2])) {
+        printf("Usage: binbench <file>, of PackedBoards\n");
+        return;
+    }
+
+    for (int pass = 0; pass < 2; ++pass) {
+
+        steady_clock::time_point start = steady_clock::now();
+
+        for (uint64_t i = 0; i < file.count; ++i) {
+            if (pass == 0) checksum += file.positions[i].occupied;
+            else unpackBoard(board, file.positions[i], 0), checksum += board.hash;
+        }
+
+        seconds[pass] = duration_cast<nanoseconds>(steady_clock::now() - start).count() / 1e9;
+    }
+
+    const double count = file.count, megabytes = file.bytes / double(1 << 20);
+
+    printf("\nPositions : %" PRIu64 " (%.1f MB)\n", file.count, megabytes);
+    printf("Stream    : %10.0f positions/sec (%.1f MB/s)\n", count / seconds[0], megabytes / seconds[0]);
+    printf("Unpack    : %10.0f positions/sec (%.1f ns each)\n", count / seconds[1], 1e9 * seconds[1] / count);
+    printf("Checksum  : %016" PRIx64 "\n", checksum);
+
+    closePackedFile(file);
+}
@@ -0,0 +1,71 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "types.h"
+
+enum {
+    PACKED_BLACK_WIN, PACKED_DRAW, PACKED_WHITE_WIN, PACKED_NO_RESULT,
+};
+
+enum {
+    PACKED_CASTLE_ROOK = 12, // 12 + colour, for a Rook which may still castle
+    PACKED_ENPASS_PAWN = 14, // A Pawn of the side not to move, which just moved two squares
+};
+
+// A position in 32 bytes, along with a score, a result and a move for use by
+// datasets. The occupied squares are listed in order in the 4-bit codes
+struct PackedBoard {
+    uint64_t occupied;
+    uint8_t pieces[16];
+    uint8_t flags;            // Side to move in bit 0, and the Half Move Counter above
+    uint8_t result;           // One of PACKED_BLACK_WIN ... PACKED_NO_RESULT
+    uint16_t fullMoveCounter;
+    int16_t score;            // From White's point of view, or VALUE_NONE
+    uint16_t move;            // NONE_MOVE when there is none
+};
+
+static_assert(sizeof(PackedBoard) == 32, "PackedBoards are 32 bytes");
+
+// A file of PackedBoards, stored back to back in native byte order, which is
+// mapped into memory and read through in order
+
+struct PackedFile {
+    const PackedBoard *positions;
+    uint64_t count;
+    size_t bytes;
+    void *buffer;
+};
+
+// Any file may be mapped for reading the same way, see texel.cpp
+int mapFile(const char *path, void *&buffer, size_t& bytes);
+void unmapFile(void *buffer, size_t bytes);
+
+int openPackedFile(PackedFile& file, const char *path);
+void closePackedFile(PackedFile& file);
+int writePackedBoard(FILE *fout, Board& board, int score, int result, uint16_t move);
+void writePackedFEN(FILE *fout, const PackedBoard& packed);
+
+int runPackFENs(int argc, char **argv);
+int runUnpackFENs(int argc, char **argv);
+void runPackedBenchmark(int argc, char **argv);
@@ -0,0 +1,258 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <pthread.h>
+#include <string>
+
+#include "board.h"
+#include "move.h"
+#include "movegen.h"
+#include "perft.h"
+#include "search.h"
+#include "time.h"
+#include "types.h"
+
+namespace {
+
+struct PerftWorker {
+    Board board;
+    PerftTable *table;
+    std::atomic<int> *next;
+    uint16_t *moves;
+    uint64_t *counts;
+    int size, depth;
+};
+
+void initPerftTable(PerftTable& table, int megabytes) {
+
+    uint64_t keySize = 0ull;
+
+    // A size of zero disables the table, otherwise we round down to the
+    // nearest power of two number of entries which fits in the given size
+    table.entries = nullptr, table.hashMask = 0ull;
+    if (megabytes <= 0) return;
+
+    for (; (sizeof(PerftEntry) << (keySize + 1)) <= (uint64_t)megabytes << 20; ++keySize);
+
+    table.hashMask = (1ull << keySize) - 1u;
+    table.entries  = new PerftEntry[1ull << keySize]();
+}
+
+uint64_t perftKey(Board& board, int depth) {
+    // Counts are only valid for a single depth, so mix it into the hash
+    return board.hash ^ (0x9E3779B97F4A7C15ull * depth);
+}
+
+uint64_t perftSearch(Board& board, int depth, PerftTable *table) {
+
+    Undo undo;
+    int size = 0;
+    uint64_t key = 0ull, found = 0ull;
+    uint16_t moves[MAX_MOVES];
+
+    if (depth == 0)
+        return 1ull;
+
+    // The table is shared by all threads without any locking. Entries are
+    // stored as (key ^ nodes, nodes), such that a torn write fails to verify
+    if (table->entries && depth >= 2) {
+        key = perftKey(board, depth);
+        PerftEntry entry = table->entries[key & table->hashMask];
+        if ((entry.check ^ entry.nodes) == key)
+            return entry.nodes;
+    }
+
+    // Bulk count the final ply, since every generated move is legal
+    genAllLegalMoves(board, moves, size);
+    if (depth == 1)
+        return size;
+
+    for (int i = 0; i < size; ++i) {
+        applyMove(board, moves[i], undo);
+        found += perftSearch(board, depth-1, table);
+        revertMove(board, moves[i], undo);
+    }
+
+    if (table->entries)
+        table->entries[key & table->hashMask] = { key ^ found, found };
+
+    return found;
+}
+
+void *perftWorker(void *arg) {
+
+    PerftWorker *worker = (PerftWorker*)arg;
+    Undo undo;
+
+    // Root moves are handed out one at a time, so that threads which finish
+    // a small subtree early will go on to help with the remaining moves
+    for (int i = (*worker->next)++; i < worker->size; i = (*worker->next)++) {
+        applyMove(worker->board, worker->moves[i], undo);
+        worker->counts[i] = perftSearch(worker->board, worker->depth-1, worker->table);
+        revertMove(worker->board, worker->moves[i], undo);
+    }
+
+    return nullptr;
+}
+
+int perftRoot(Board& board, int depth, int nthreads, int megabytes, uint16_t *moves, uint64_t *counts) {
+
+    int size = 0;
+    PerftTable table;
+    std::atomic<int> next(0);
+
+    genAllLegalMoves(board, moves, size);
+    initPerftTable(table, megabytes);
+
+    nthreads = nthreads < 1 ? 1 : nthreads;
+    PerftWorker *workers = new PerftWorker[nthreads];
+    pthread_t *pthreads = new pthread_t[nthreads];
+
+    // Each thread works on its own copy of the Board
+    for (int i = 0; i < nthreads; ++i) {
+        workers[i] = { board, &table, &next, moves, counts, size, depth };
+        pthread_create(&pthreads[i], nullptr, perftWorker, &workers[i]);
+    }
+
+    for (int i = 0; i < nthreads; ++i)
+        pthread_join(pthreads[i], nullptr);
+
+    delete[] table.entries;
+    delete[] pthreads;
+    delete[] workers;
+
+    return size;
+}
+}
+
+uint64_t perft(Board& board, int depth, int nthreads, int megabytes) {
+
+    uint64_t found = 0ull, counts[MAX_MOVES];
+    uint16_t moves[MAX_MOVES];
+
+    if (depth <= 0)
+        return 1ull;
+
+    int size = perftRoot(board, depth, nthreads, megabytes, moves, counts);
+
+    for (int i = 0; i < size; ++i)
+        found += counts[i];
+
+    return found;
+}
+
+void perftDivide(Board& board, int depth, int nthreads, int megabytes) {
+
+    char moveStr[6];
+    uint64_t found = 0ull, counts[MAX_MOVES];
+    uint16_t moves[MAX_MOVES];
+
+    if (depth <= 0) {
+        printf("\nNodes : 1\n"), fflush(stdout);
+        return;
+    }
+
+    double start = getRealTime();
+    int size = perftRoot(board, depth, nthreads, megabytes, moves, counts);
+    double elapsed = getRealTime() - start;
+
+    // Report each root move in the same notation that UCI would use
+    for (int i = 0; i < size; ++i) {
+        moveToString(moves[i], moveStr, board.chess960);
+        printf("%s: %" PRIu64 "\n", moveStr, counts[i]);
+        found += counts[i];
+    }
+
+    printf("\nMoves : %d\n", size);
+    printf("Nodes : %" PRIu64 "\n", found);
+    printf("Time  : %dms\n", (int)elapsed);
+    printf("NPS   : %" PRIu64 "\n", (uint64_t)(found / ((elapsed + 1.0) / 1000.0)));
+    fflush(stdout);
+}
+
+int runPerftSuite(int argc, char **argv) {
+
+    // Usage: perftsuite <epdfile> [maxdepth] [threads] [megabytes]. Each line
+    // of the EPD holds a FEN followed by the expected counts, as in
+    // "<fen> ;D1 20 ;D2 400 ;D3 8902". Depths past maxdepth are skipped
+
+    Board board;
+    std::string line;
+    uint64_t nodes = 0ull;
+    int positions = 0, failures = 0;
+
+    if (argc < 3) {
+        printf("Usage: %s perftsuite <epdfile> [maxdepth] [threads] [megabytes]\n", argv[0]);
+        return 1;
+    }
+
+    int maxDepth  = argc > 3 ? atoi(argv[3]) : 6;
+    int nthreads  = argc > 4 ? atoi(argv[4]) : 1;
+    int megabytes = argc > 5 ? atoi(argv[5]) : 16;
+
+    std::ifstream epd(argv[2]);
+    if (!epd.is_open()) {
+        printf("Unable to open %s\n", argv[2]);
+        return 1;
+    }
+
+    double start = getRealTime();
+
+    while (getline(epd, line)) {
+
+        size_t split = line.find(';');
+        if (split == std::string::npos) continue;
+
+        boardFromFEN(board, line.substr(0, split), 0);
+        positions += 1;
+
+        // Walk each ";D<depth> <count>" entry following the FEN
+        for (size_t at = split; at != std::string::npos; at = line.find(';', at + 1)) {
+
+            int depth; uint64_t expected;
+            if (   sscanf(line.c_str() + at, ";D%d %" SCNu64, &depth, &expected) != 2
+                || depth > maxDepth)
+                continue;
+
+            uint64_t found = perft(board, depth, nthreads, megabytes);
+            nodes += found;
+
+            if (found != expected) {
+                failures += 1;
+                printf("FAIL #%d D%d : expected %" PRIu64 " found %" PRIu64 " : %s\n",
+                       positions, depth, expected, found, line.substr(0, split).c_str());
+            }
+        }
+    }
+
+    double elapsed = getRealTime() - start;
+
+    printf("\nPositions : %d\n", positions);
+    printf("Failures  : %d\n", failures);
+    printf("Time      : %dms\n", (int)elapsed);
+    printf("Nodes     : %" PRIu64 "\n", nodes);
+    printf("NPS       : %" PRIu64 "\n", (uint64_t)(nodes / ((elapsed + 1.0) / 1000.0)));
+
+    return failures != 0;
+}
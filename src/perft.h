@@ -0,0 +1,36 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "types.h"
+
+struct PerftEntry {
+    uint64_t check, nodes;
+};
+
+struct PerftTable {
+    PerftEntry *entries;
+    uint64_t hashMask;
+};
+
+uint64_t perft(Board& board, int depth, int nthreads, int megabytes);
+void perftDivide(Board& board, int depth, int nthreads, int megabytes);
+int runPerftSuite(int argc, char **argv);
@@ -55,7 +55,7 @@ void initSearch() {
 				LMRTable[depth][played] = 0.75 + log(depth) * log(played) / 2.25;
 }
 
-void getBestMove(Thread *threads, Board& board, Limits& limits, uint16_t& best, uint16_t& ponder) {
+void getBestMove(Thread *threads, Board& board, const uint64_t *keys, Limits& limits, uint16_t& best, uint16_t& ponder) {
 
 	SearchInfo info = {};
 	pthread_t *pthreads = new pthread_t[threads->nthreads];
@@ -65,11 +65,10 @@ void getBestMove(Thread *threads, Board& board, Limits& limits, uint16_t& best,
 	if (tablebasesProbeDTZ(board, best, ponder))
 		return;
 
-	// Minor house keeping for starting a search
-	updateTT(); // Table has an age component
-	ABORT_SIGNAL = 0; // Otherwise Threads will exit
+	// Minor house keeping for starting a search. Callers age the Table and
+	// clear ABORT_SIGNAL, since several searches may share both at once
 	initTimeManagment(info, limits);
-	newSearchThreadPool(threads, board, limits, info);
+	newSearchThreadPool(threads, board, keys, limits, info);
 
 	// Create a new thread for each of the helpers and reuse the current
 	// thread for the main thread, which avoids some overhead and saves
@@ -79,8 +78,9 @@ void getBestMove(Thread *threads, Board& board, Limits& limits, uint16_t& best,
 	iterativeDeepening((void*) threads);
 
 	// When the main thread exits it should signal for the helpers to
-	// shutdown. Wait until all helpers have finished before moving on
-	ABORT_SIGNAL = 1;
+	// shutdown. Wait until all helpers have finished before moving on.
+	// The signal belongs to this search alone, as others may be running
+	info.stop = 1;
 	for (int i = 1; i < threads->nthreads; ++i)
 		pthread_join(pthreads[i], nullptr);
 
@@ -145,7 +145,7 @@ void* iterativeDeepening(void *vthread) {
 
 void aspirationWindow(Thread *thread) {
 
-	PVariation& pv = thread->pv;
+	PVariation& pv = thread->pvs[0];
 	const int multiPV    = thread->multiPV;
 	const int mainThread = thread->index == 0;
 
@@ -161,9 +161,9 @@ void aspirationWindow(Thread *thread) {
 	while (1) {
 
 		// Perform a search and consider reporting results
-		value = search(thread, pv, alpha, beta, thread->depth, 0);
-		if (   (mainThread && value > alpha && value < beta)
-				|| (mainThread && elapsedTime(*thread->info) >= WindowTimerMS))
+		value = search(thread, alpha, beta, thread->depth, 0);
+		if (   (mainThread && !thread->limits->silent && value > alpha && value < beta)
+				|| (mainThread && !thread->limits->silent && elapsedTime(*thread->info) >= WindowTimerMS))
 				uciReport(thread->threads, alpha, beta, value);
 
 		// Search returned a result within our window. Save the eval as well
@@ -191,26 +191,26 @@ void aspirationWindow(Thread *thread) {
 	}
 }
 
-int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int height) {
+int search(Thread *thread, int alpha, int beta, int depth, int height) {
 
 	const int PvNode   = (alpha != beta-1);
 	const int RootNode = (height == 0);
 	Board& board = thread->board;
 
 	unsigned tbresult;
-	int hist = 0, cmhist = 0, fmhist = 0, quietsSeen = 0, quietsPlayed = 0, played = 0;
+	int hist = 0, cmhist = 0, fmhist = 0, quietsSeen = 0, quietsPlayed = 0, capturesPlayed = 0, played = 0;
 	int ttHit, ttValue = 0, ttEval = 0, ttDepth = 0, ttBound = 0;
 	int R, newDepth, rAlpha, rBeta, oldAlpha = alpha;
 	int inCheck, isQuiet, improving, extension, singular, skipQuiets = 0;
 	int eval, value = -MATE, best = -MATE, futilityMargin, seeMargin[2];
-	uint16_t move, ttMove = NONE_MOVE, bestMove = NONE_MOVE, quietsTried[MAX_MOVES];
-	MovePicker movePicker;
-	PVariation lpv;
+	uint16_t move, ttMove = NONE_MOVE, bestMove = NONE_MOVE, quietsTried[MAX_MOVES], capturesTried[MAX_MOVES];
+	MovePicker& movePicker = thread->pickers[height][0];
+	PVariation& pv = thread->pvs[height];
 
 	// Step 1. Quiescence Search. Perform a search using mostly tactical
 	// moves to reach a more stable position for use as a static evaluation
 	if (depth <= 0 && !board.kingAttackers)
-		return qsearch(thread, pv, alpha, beta, height);
+		return qsearch(thread, alpha, beta, height);
 
 	// Ensure a fresh PV
 	pv.length = 0;
@@ -223,8 +223,8 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 	++thread->nodes;
 
 	// Step 2. Abort Check. Exit the search if signaled by main thread or the
-	// UCI thread, or if the search time has expired outside pondering mode
-	if (ABORT_SIGNAL || (terminateSearchEarly(thread) && !IS_PONDERING))
+	// UCI thread, or if the search time or nodes ran out outside pondering mode
+	if (ABORT_SIGNAL || thread->info->stop || (terminateSearchEarly(thread) && !IS_PONDERING))
 		longjmp(thread->jbuffer, 1);
 
 	// Step 3. Check for early exit conditions. Don't take early exits in
@@ -233,12 +233,27 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 
 		// Check for the fifty move rule, a draw by
 		// repetition, or insufficient mating material
-		if (boardIsDrawn(board, height))
+		if (boardIsDrawn(board, thread->repetitions.keys, height))
 				return 0;
 
+		// Check for an upcoming repetition. When a move returns to a position
+		// from earlier in the search, we can expect at least a draw from here
+		if (alpha < 0 && board.halfMoveCounter >= 3) {
+
+				int pliesFromNull = height;
+				for (int i = 1; i <= height; i++)
+					if (thread->moveStack[height - i] == NULL_MOVE)
+						{ pliesFromNull = i - 1; break; }
+
+				if (boardHasUpcomingRepetition(board, thread->repetitions.keys, height, pliesFromNull)) {
+					alpha = oldAlpha = 0;
+					if (alpha >= beta) return alpha;
+				}
+		}
+
 		// Check to see if we have exceeded the maxiumum search draft
 		if (height >= MAX_PLY)
-				return evaluateBoard(board, thread->pktable);
+				return evaluateCached(thread, board);
 
 		// Mate Distance Pruning. Check to see if this line is so
 		// good, or so bad, that being mated in the ply, or  mating in
@@ -303,7 +318,7 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 	// can recompute the eval as `eval = -last_eval + 2 * Tempo`
 	eval = thread->evalStack[height] =
 			ttHit && ttEval != VALUE_NONE            ?  ttEval
-			: thread->moveStack[height-1] != NULL_MOVE ?  evaluateBoard(board, thread->pktable)
+			: thread->moveStack[height-1] != NULL_MOVE ?  evaluateCached(thread, board)
 																	: -thread->evalStack[height-1] + 2 * Tempo;
 
 	// Futility Pruning Margin
@@ -326,7 +341,7 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 		&& !inCheck
 		&&  depth <= RazorDepth
 		&&  eval + RazorMargin < alpha)
-		return qsearch(thread, pv, alpha, beta, height);
+		return qsearch(thread, alpha, beta, height);
 
 	// Step 8. Beta Pruning / Reverse Futility Pruning / Static Null
 	// Move Pruning. If the eval is well above beta, defined by a depth
@@ -354,7 +369,7 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 		R = 4 + depth / 6 + MIN(3, (eval - beta) / 200);
 
 		apply(thread, board, NULL_MOVE, height);
-		value = -search(thread, lpv, -beta, -beta+1, depth-R, height+1);
+		value = -search(thread, -beta, -beta+1, depth-R, height+1);
 		revert(thread, board, NULL_MOVE, height);
 
 		if (value >= beta) return beta;
@@ -375,7 +390,7 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 
 				// Perform a reduced depth verification search
 				if (!apply(thread, board, move, height)) continue;
-				value = -search(thread, lpv, -rBeta, -rBeta+1, depth-4, height+1);
+				value = -search(thread, -rBeta, -rBeta+1, depth-4, height+1);
 				revert(thread, board, move, height);
 
 				// Probcut failed high
@@ -385,7 +400,7 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 
 	// Step 11. Initialize the Move Picker and being searching through each
 	// move one at a time, until we run out or a move generates a cutoff
-	initMovePicker(movePicker, thread, ttMove, height);
+	initMovePicker(movePicker, thread, ttMove, height, depth);
 	while ((move = selectNextMove(movePicker, board, skipQuiets)) != NONE_MOVE) {
 
 		// In MultiPV mode, skip over already examined lines
@@ -452,11 +467,17 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 		played += 1;
 		if (isQuiet)
 				quietsTried[quietsPlayed++] = move;
+		else
+				capturesTried[capturesPlayed++] = move;
+
+#ifdef PICKER_STATS
+		recordPickerMove(thread->pickerStats, movePicker, depth);
+#endif
 
 		// The UCI spec allows us to output information about the current move
 		// that we are going to search. We only do this from the main thread,
 		// and we wait a few seconds in order to avoid floiding the output
-		if (RootNode && !thread->index && elapsedTime(*thread->info) > CurrmoveTimerMS)
+		if (RootNode && !thread->index && !thread->limits->silent && elapsedTime(*thread->info) > CurrmoveTimerMS)
 				uciReportCurrentMove(board, move, played + thread->multiPV, depth);
 
 		// Step 14. Late Move Reductions. Compute the reduction,
@@ -504,21 +525,21 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 		// Step 16A. If we triggered the LMR conditions (which we know by the value of R),
 		// then we will perform a reduced search on the null alpha window, as we have no
 		// expectation that this move will be worth looking into deeper
-		if (R != 1) value = -search(thread, lpv, -alpha-1, -alpha, newDepth-R, height+1);
+		if (R != 1) value = -search(thread, -alpha-1, -alpha, newDepth-R, height+1);
 
 		// Step 16B. There are two situations in which we will search again on a null window,
 		// but without a depth reduction R. First, if the LMR search happened, and failed
 		// high, secondly, if we did not try an LMR search, and this is not the first move
 		// we have tried in a PvNode, we will research with the normally reduced depth
 		if ((R != 1 && value > alpha) || (R == 1 && !(PvNode && played == 1)))
-				value = -search(thread, lpv, -alpha-1, -alpha, newDepth-1, height+1);
+				value = -search(thread, -alpha-1, -alpha, newDepth-1, height+1);
 
 		// Step 16C. Finally, if we are in a PvNode and a move beat alpha while being
 		// search on a reduced depth, we will search again on the normal window. Also,
 		// if we did not perform Step 18B, we will search for the first time on the
 		// normal window. This happens only for the first move in a PvNode
 		if (PvNode && (played == 1 || value > alpha))
-				value = -search(thread, lpv, -beta, -alpha, newDepth-1, height+1);
+				value = -search(thread, -beta, -alpha, newDepth-1, height+1);
 
 		// Revert the board state
 		revert(thread, board, move, height);
@@ -533,10 +554,14 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 				if (value > alpha) {
 					alpha = value;
 
-					// Copy our child's PV and prepend this move to it
-					pv.length = 1 + lpv.length;
-					pv.line[0] = move;
-					memcpy(pv.line + 1, lpv.line, sizeof(uint16_t) * lpv.length);
+					// Copy our child's PV and prepend this move to it. Only PvNodes
+					// may improve alpha without failing high, so only they need to
+					if (PvNode) {
+						PVariation& lpv = thread->pvs[height+1];
+						pv.length = 1 + lpv.length;
+						pv.line[0] = move;
+						memcpy(pv.line + 1, lpv.line, sizeof(uint16_t) * lpv.length);
+					}
 
 					// Search failed high
 					if (alpha >= beta) break;
@@ -551,10 +576,19 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 	// can differentiate between close mates and far away mates from the root
 	if (played == 0) return inCheck ? -MATE + height : 0;
 
-	// Step 19. Update History counters on a fail high for a quiet move
+#ifdef PICKER_STATS
+	recordPickerNode(thread->pickerStats, movePicker, depth, played, best >= beta);
+#endif
+
+	// Step 19. Update History counters on a fail high. Quiet histories are
+	// only updated for a quiet best move, but the noisy moves tried always
+	// receive a malus, unless they themselves caused the cutoff
 	if (best >= beta && !moveIsTactical(board, bestMove))
 		updateHistoryHeuristics(thread, quietsTried, quietsPlayed, height, depth*depth);
 
+	if (best >= beta)
+		updateCaptureHistories(thread, bestMove, capturesTried, capturesPlayed, depth*depth);
+
 	// Step 20. Store results of search into the Transposition Table. We do
 	// not overwrite the Root entry from the first line of play we examined
 	if (!RootNode || !thread->multiPV) {
@@ -566,15 +600,16 @@ int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int h
 	return best;
 }
 
-int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
+int qsearch(Thread *thread, int alpha, int beta, int height) {
 
+	const int PvNode = (alpha != beta-1);
 	Board& board = thread->board;
 
 	int eval, value, best, margin;
 	int ttHit, ttValue = 0, ttEval = 0, ttDepth = 0, ttBound = 0;
 	uint16_t move, ttMove = NONE_MOVE;
-	MovePicker movePicker;
-	PVariation lpv;
+	MovePicker& movePicker = thread->pickers[height][0];
+	PVariation& pv = thread->pvs[height];
 
 	// Ensure a fresh PV
 	pv.length = 0;
@@ -584,19 +619,19 @@ int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
 	thread->nodes++;
 
 	// Step 1. Abort Check. Exit the search if signaled by main thread or the
-	// UCI thread, or if the search time has expired outside pondering mode
-	if (ABORT_SIGNAL || (terminateSearchEarly(thread) && !IS_PONDERING))
+	// UCI thread, or if the search time or nodes ran out outside pondering mode
+	if (ABORT_SIGNAL || thread->info->stop || (terminateSearchEarly(thread) && !IS_PONDERING))
 		longjmp(thread->jbuffer, 1);
 
 	// Step 2. Draw Detection. Check for the fifty move rule,
 	// a draw by repetition, or insufficient mating material
-	if (boardIsDrawn(board, height))
+	if (boardIsDrawn(board, thread->repetitions.keys, height))
 		return 0;
 
 	// Step 3. Max Draft Cutoff. If we are at the maximum search draft,
 	// then end the search here with a static eval of the current board
 	if (height >= MAX_PLY)
-		return evaluateBoard(board, thread->pktable);
+		return evaluateCached(thread, board);
 
 	// Step 4. Probe the Transposition Table, adjust the value, and consider cutoffs
 	if ((ttHit = getTTEntry(board.hash, &ttMove, &ttValue, &ttEval, &ttDepth, &ttBound))) {
@@ -615,7 +650,7 @@ int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
 	// can recompute the eval as `eval = -last_eval + 2 * Tempo`
 	eval = thread->evalStack[height] =
 			ttHit && ttEval != VALUE_NONE            ?  ttEval
-			: thread->moveStack[height-1] != NULL_MOVE ?  evaluateBoard(board, thread->pktable)
+			: thread->moveStack[height-1] != NULL_MOVE ?  evaluateCached(thread, board)
 																	: -thread->evalStack[height-1] + 2 * Tempo;
 
 	// Step 5. Eval Pruning. If a static evaluation of the board will
@@ -639,7 +674,7 @@ int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
 
 		// Search the next ply if the move is legal
 		if (!apply(thread, board, move, height)) continue;
-		value = -qsearch(thread, lpv, -beta, -alpha, height+1);
+		value = -qsearch(thread, -beta, -alpha, height+1);
 		revert(thread, board, move, height);
 
 		// Improved current value
@@ -650,10 +685,13 @@ int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
 				if (value > alpha) {
 					alpha = value;
 
-					// Update the Principle Variation
-					pv.length = 1 + lpv.length;
-					pv.line[0] = move;
-					memcpy(pv.line + 1, lpv.line, sizeof(uint16_t) * lpv.length);
+					// Update the Principle Variation, which is only needed in PvNodes
+					if (PvNode) {
+						PVariation& lpv = thread->pvs[height+1];
+						pv.length = 1 + lpv.length;
+						pv.line[0] = move;
+						memcpy(pv.line + 1, lpv.line, sizeof(uint16_t) * lpv.length);
+					}
 				}
 		}
 
@@ -665,6 +703,26 @@ int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height) {
 	return best;
 }
 
+int evaluateCached(Thread *thread, Board& board) {
+
+	int eval;
+
+	// The cache may have been disabled by the user
+	if (!thread->evcache.entries)
+		return evaluateBoard(board, *thread->pktable, thread->mtable);
+
+	// Reuse a previous evaluation of this exact position
+	thread->evalProbes++;
+	if (getEvalCacheEntry(thread->evcache, board.hash, &eval)) {
+		thread->evalHits++;
+		return eval;
+	}
+
+	eval = evaluateBoard(board, *thread->pktable, thread->mtable);
+	storeEvalCacheEntry(thread->evcache, board.hash, eval);
+	return eval;
+}
+
 int staticExchangeEvaluation(Board& board, uint16_t move, int threshold) {
 
 	int from, to, type, colour, balance, nextVictim;
@@ -764,21 +822,20 @@ int moveIsSingular(Thread *thread, uint16_t ttMove, int ttValue, int depth, int
 	uint16_t move;
 	int skipQuiets = 0, quiets = 0, tacticals = 0;
 	int value = -MATE, rBeta = MAX(ttValue - depth, -MATE);
-	MovePicker movePicker;
-	PVariation lpv; lpv.length = 0;
+	MovePicker& movePicker = thread->pickers[height][1];
 
 	// Table move was already applied
 	revert(thread, board, ttMove, height);
 
 	// Iterate over each move, except for the table move
-	initSingularMovePicker(movePicker, thread, ttMove, height);
+	initSingularMovePicker(movePicker, thread, ttMove, height, depth);
 	while ((move = selectNextMove(movePicker, board, skipQuiets)) != NONE_MOVE) {
 
 		assert(move != ttMove); // Skip the table move
 
 		// Perform a reduced depth search on a null rbeta window
 		if (!apply(thread, board, move, height)) continue;
-		value = -search(thread, lpv, -rBeta-1, -rBeta, depth / 2 - 1, height+1);
+		value = -search(thread, -rBeta-1, -rBeta, depth / 2 - 1, height+1);
 		revert(thread, board, move, height);
 
 		// Move failed high, thus ttMove is not singular
@@ -27,6 +27,7 @@ struct SearchInfo {
     uint16_t bestMoves[MAX_PLY], ponderMoves[MAX_PLY];
     double startTime, idealUsage, maxAlloc, maxUsage;
     int pvFactor;
+    volatile int stop; // Set by the main thread for its helpers
 };
 
 struct PVariation {
@@ -35,11 +36,12 @@ struct PVariation {
 };
 
 void initSearch();
-void getBestMove(Thread *threads, Board& board, Limits& limits, uint16_t& best, uint16_t& ponder);
+void getBestMove(Thread *threads, Board& board, const uint64_t *keys, Limits& limits, uint16_t& best, uint16_t& ponder);
 void* iterativeDeepening(void *vthread);
 void aspirationWindow(Thread *thread);
-int search(Thread *thread, PVariation& pv, int alpha, int beta, int depth, int height);
-int qsearch(Thread *thread, PVariation& pv, int alpha, int beta, int height);
+int search(Thread *thread, int alpha, int beta, int depth, int height);
+int qsearch(Thread *thread, int alpha, int beta, int height);
+int evaluateCached(Thread *thread, Board& board);
 int staticExchangeEvaluation(Board& board, uint16_t move, int threshold);
 int moveIsSingular(Thread *thread, uint16_t ttMove, int ttValue, int depth, int height);
 
@@ -18,15 +18,23 @@
 
 #ifdef TUNE
 
+
+#include <chrono>
 #include <math.h>
+#include <omp.h>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <sys/stat.h>
+#include <vector>
 
 #include "bitboards.h"
 #include "board.h"
 #include "evaluate.h"
 #include "history.h"
 #include "move.h"
+#include "packed.h"
 #include "search.h"
 #include "texel.h"
 #include "thread.h"
@@ -35,73 +43,56 @@
 #include "uci.h"
 #include "zobrist.h"
 
-// Internal Memory Managment
-TexelTuple* TupleStack;
-int TupleStackSize = STACKSIZE;
-
 // Tap into evaluate()
 extern EvalTrace T, EmptyTrace;
 
-extern const int PawnValue;
-extern const int KnightValue;
-extern const int BishopValue;
-extern const int RookValue;
-extern const int QueenValue;
-extern const int KingValue;
-extern const int PawnPSQT32[32];
-extern const int KnightPSQT32[32];
-extern const int BishopPSQT32[32];
-extern const int RookPSQT32[32];
-extern const int QueenPSQT32[32];
-extern const int KingPSQT32[32];
-extern const int PawnCandidatePasser[2][8];
-extern const int PawnIsolated;
-extern const int PawnStacked[2];
-extern const int PawnBackwards[2];
-extern const int PawnConnected32[32];
-extern const int KnightOutpost[2][2];
-extern const int KnightBehindPawn;
-extern const int ClosednessKnightAdjustment[9];
-extern const int KnightMobility[9];
-extern const int BishopPair;
-extern const int BishopRammedPawns;
-extern const int BishopOutpost[2][2];
-extern const int BishopBehindPawn;
-extern const int BishopMobility[14];
-extern const int RookFile[2];
-extern const int RookOnSeventh;
-extern const int ClosednessRookAdjustment[9];
-extern const int RookMobility[15];
-extern const int QueenMobility[28];
-extern const int KingDefenders[12];
-extern const int KingPawnFileProximity[8];
-extern const int KingShelter[2][8][8];
-extern const int KingStorm[2][4][8];
-extern const int PassedPawn[2][2][8];
-extern const int PassedFriendlyDistance[8];
-extern const int PassedEnemyDistance[8];
-extern const int PassedSafePromotionPath;
-extern const int ThreatWeakPawn;
-extern const int ThreatMinorAttackedByPawn;
-extern const int ThreatMinorAttackedByMinor;
-extern const int ThreatMinorAttackedByMajor;
-extern const int ThreatRookAttackedByLesser;
-extern const int ThreatMinorAttackedByKing;
-extern const int ThreatRookAttackedByKing;
-extern const int ThreatQueenAttackedByOne;
-extern const int ThreatOverloadedPieces;
-extern const int ThreatByPawnPush;
-extern const int ComplexityTotalPawns;
-extern const int ComplexityPawnFlanks;
-extern const int ComplexityPawnEndgame;
-extern const int ComplexityAdjustment;
-
-void runTexelTuning(Thread *thread) {
-
-    TexelEntry *tes;
-    int iteration = -1;
+static const char *texelBlock(TexelFile& file, uint64_t block) {
+    return file.data + block * BLOCKSIZE;
+}
+
+static uint32_t texelBlockCount(TexelFile& file, uint64_t block) {
+    return *(const uint32_t*)texelBlock(file, block);
+}
+
+static int statTexelDataset(const char *dataset, uint64_t& bytes, int64_t& time) {
+
+    struct stat st;
+
+    if (stat(dataset, &st)) {
+        bytes = 0, time = 0;
+        return 0;
+    }
+
+    bytes = st.st_size, time = st.st_mtime;
+    return 1;
+}
+
+static const TexelTuple *texelTuples(const TexelEntry& te) {
+    return (const TexelTuple*)(&te + 1);
+}
+
+static const TexelEntry *nextTexelEntry(const TexelEntry *te) {
+    return (const TexelEntry*)(texelTuples(*te) + te->ntuples);
+}
+
+void runTexelTuning(Thread *thread, int argc, char **argv) {
+
+    using namespace std::chrono;
+
+    TexelFile file;
+    TexelAccumulator *accumulators;
+    uint32_t *order;
+    int epoch = -1;
     double K, error, best = 1e6, rate = LEARNING;
-    TexelVector params = {0}, cparams = {0}, phases = {0};
+    TexelVector params = {}, cparams = {}, phases = {};
+
+    // Usage: Ethereal [dataset] [coefficients]. The dataset holds lines of
+    // "<fen> [<result>] <score>", or PackedBoards when its name ends in .bin.
+    // The Coefficient File is built from it once, and reused after that for
+    // as long as NTERMS and the dataset match. Delete it after changing the
+    // weights, which are not recorded
+    const char *dataset = argc > 1 ? argv[1] : "FENS";
+    const string coefficients = argc > 2 ? string(argv[2]) : string(dataset) + ".coeffs";
 
     setvbuf(stdout, nullptr, _IONBF, 0);
 
@@ -110,14 +101,29 @@ void runTexelTuning(Thread *thread) {
     cout << "\n\nSETTING TABLE SIZE TO 1MB FOR SPEED...";
     initTT(1);
 
-    cout << "\n\nALLOCATING MEMORY FOR TEXEL ENTRIES [" << int(NPOSITIONS * sizeof(TexelEntry) / (1024 * 1024)) << "MB]...";
-    tes = calloc(NPOSITIONS, sizeof(TexelEntry));
+    if (!openTexelFile(file, coefficients.c_str(), dataset)) {
+
+        cout << "\n\nBUILDING COEFFICIENT FILE " << coefficients << " FROM " << dataset << "...";
+        initTexelFile(dataset, coefficients.c_str(), thread);
 
-    cout << "\n\nALLOCATING MEMORY FOR TEXEL TUPLE STACK [" << int(STACKSIZE * sizeof(TexelTuple) / (1024 * 1024)) << "MB]...";
-    TupleStack = calloc(STACKSIZE, sizeof(TexelTuple));
+        if (!openTexelFile(file, coefficients.c_str(), dataset)) {
+            cout << "\nUnable to open " << coefficients << "\n";
+            exit(EXIT_FAILURE);
+        }
+    }
 
-    cout << "\n\nINITIALIZING TEXEL ENTRIES FROM FENS...";
-    initTexelEntries(tes, thread);
+    cout << "\n\nSTREAMING " << file.positions << " POSITIONS IN " << file.blocks
+         << " BLOCKS FROM " << coefficients << " [" << (file.bytes >> 20) << "MB]...";
+
+    // Memory use does not depend on the size of the dataset, beyond the
+    // order of the blocks. The OS pages the Coefficient File in and out
+    cout << "\n\nALLOCATING " << omp_get_max_threads() << " GRADIENT ACCUMULATORS ["
+         << (omp_get_max_threads() * sizeof(TexelAccumulator) >> 10) << "KB]...";
+    accumulators = (TexelAccumulator*)calloc(omp_get_max_threads(), sizeof(TexelAccumulator));
+    order = (uint32_t*)malloc(sizeof(uint32_t) * file.blocks);
+
+    for (uint64_t i = 0; i < file.blocks; ++i)
+        order[i] = i;
 
     cout << "\n\nFETCHING CURRENT EVALUATION TERMS AS A STARTING POINT...";
     initCurrentParameters(cparams);
@@ -126,122 +132,236 @@ void runTexelTuning(Thread *thread) {
     initPhaseManager(phases);
 
     cout << "\n\nCOMPUTING OPTIMAL K VALUE...\n";
-    K = computeOptimalK(tes);
+    K = computeOptimalK(file);
 
     while (1) {
 
-        // Shuffle the dataset before each epoch
-        if (NPOSITIONS != BATCHSIZE)
-            shuffleTexelEntries(tes);
+        steady_clock::time_point start = steady_clock::now();
+
+        // Shuffle the blocks before each epoch
+        if (BATCHSIZE)
+            shuffleTexelBlocks(order, file.blocks);
 
-        // Report every REPORTING iterations
-        if (++iteration % REPORTING == 0) {
+        // Report every REPORTING epochs
+        if (++epoch % REPORTING == 0) {
 
             // Check for a regression in tuning
-            error = completeLinearError(tes, params, K);
+            error = completeLinearError(file, params, K);
             if (error > best) rate = rate / LRDROPRATE;
 
             // Report current best parameters
             best = error;
             printParameters(params, cparams);
-            cout << "\nIteration [" << iteration << "] Error = " << best << " \n";
+            cout << "\nIteration [" << epoch << "] Error = " << best << " \n";
         }
 
-        for (int batch = 0; batch < NPOSITIONS / BATCHSIZE; ++batch) {
+        // Each mini-batch is a run of whole blocks, holding BATCHSIZE
+        // positions or slightly more. A BATCHSIZE of 0 takes every block,
+        // and is not compared against directly, as count is unsigned
+        const uint64_t batchsize = BATCHSIZE ? BATCHSIZE : UINT64_MAX;
 
-            TexelVector gradient = {0};
-            updateGradient(tes, gradient, params, phases, K, batch);
+        for (uint64_t first = 0, last; first < file.blocks; first = last) {
+
+            uint64_t count = 0;
+            for (last = first; last < file.blocks && count < batchsize; ++last)
+                count += texelBlockCount(file, order[last]);
+
+            TexelVector gradient = {};
+            count = updateGradient(file, order, first, last, accumulators, gradient, params, phases, K);
 
             // Update Parameters. Note that in updateGradient() we skip the multiplcation by negative
-            // two over BATCHSIZE. This is done only here, just once, for precision and a speed gain
+            // two over the size of the batch. This is done only here, just once, for precision and speed
             for (int i = 0; i < NTERMS; ++i)
                 for (int j = MG; j <= EG; ++j)
-                    params[i][j] += (2.0 / BATCHSIZE) * rate * gradient[i][j];
+                    params[i][j] += (2.0 / count) * rate * gradient[i][j];
         }
+
+        const double seconds = duration<double>(steady_clock::now() - start).count();
+        cout << "Epoch [" << epoch << "] took " << seconds << " seconds ("
+             << uint64_t(file.positions / seconds) << " positions/sec)\n";
     }
 }
 
-void initTexelEntries(TexelEntry *tes, Thread *thread) {
+void initTexelFile(const char *dataset, const char *path, Thread *thread) {
+
+    Undo undo;
+    Limits limits = {};
+    SearchInfo info = {};
+    PackedFile packed;
+    TexelEntry entry;
+    TexelHeader header = {};
+    char line[256];
+    int searchEval, coeffs[NTERMS];
+    vector<char> block(BLOCKSIZE);
+    PKTable *nopktable = new PKTable(true); // Every Pawn King term is traced
+    size_t used = sizeof(uint32_t);
+    uint32_t count = 0;
+
+    const size_t length = strlen(dataset);
+    const bool binary = length > 4 && !strcmp(dataset + length - 4, ".bin");
+
+    FILE *fin = binary ? nullptr : fopen(dataset, "r");
+
+    if (binary ? !openPackedFile(packed, dataset) : fin == nullptr) {
+        cout << "Unable to open " << dataset << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    FILE *fout = fopen(path, "wb");
 
-    Undo undo[1];
-    Limits limits;
-    char line[128];
-    int i, j, k, searchEval, coeffs[NTERMS];
-    FILE *fin = fopen("FENS", "r");
+    if (fout == nullptr) {
+        cout << "Unable to open " << path << "\n";
+        exit(EXIT_FAILURE);
+    }
 
     // Initialize the thread for the search
-    thread->limits = &limits; thread->depth  = 0;
+    thread->limits = &limits; thread->info = &info; thread->depth = 0;
+    reserveRepetitionStack(thread->repetitions, MAX_PLY + 1);
 
-    // Create a TexelEntry for each FEN
-    for (i = 0; i < NPOSITIONS; ++i) {
+    // The header is written again once the totals are known
+    header.magic     = TexelMagic;
+    header.nterms    = NTERMS;
+    header.blocksize = BLOCKSIZE;
+    statTexelDataset(dataset, header.datasetBytes, header.datasetTime);
+    fwrite(&header, sizeof(TexelHeader), 1, fout);
 
-        // Read next position from the FEN file
-        if (fgets(line, 128, fin) == nullptr) {
-            cout << "Unable to read line #" << i << "\n";
-            exit(EXIT_FAILURE);
+    // Create a TexelEntry for each position
+    for (uint64_t i = 0; ; ++i) {
+
+        // Read the next position, along with the result of the game and a
+        // WHITE POV search. The PACKED_* results are half points for WHITE
+        if (binary) {
+
+            if (i == packed.count) break;
+            if (packed.positions[i].result == PACKED_NO_RESULT) continue;
+
+            unpackBoard(thread->board, packed.positions[i], 0);
+            entry.result = packed.positions[i].result;
+            searchEval   = packed.positions[i].score;
         }
 
-        // Occasional reporting for total completion
-        if ((i + 1) % 10000 == 0 || i == NPOSITIONS - 1)
-            cout << "\rINITIALIZING TEXEL ENTRIES FROM FENS...  [" << i + 1 << "d OF " << NPOSITIONS << "d]";
+        else {
 
-        // Fetch and cap a white POV search
-        searchEval = atoi(strstr(line, "] ") + 2);
-        if (strstr(line, " b ")) searchEval *= -1;
+            if (fgets(line, sizeof(line), fin) == nullptr) break;
+            if (!strchr(line, '/')) continue;
 
-        // Determine the result of the game
-        if      (strstr(line, "[1.0]")) tes[i].result = 1.0;
-        else if (strstr(line, "[0.0]")) tes[i].result = 0.0;
-        else if (strstr(line, "[0.5]")) tes[i].result = 0.5;
-        else    {cout << "Cannot Parse " << line); exit(EXIT_FAILURE << "\n";}
+            // Lines without a result, such as the [*] of bin2fen, are skipped
+            // just as the PackedBoards without one are
+            if      (strstr(line, "[1.0]")) entry.result = 2;
+            else if (strstr(line, "[0.0]")) entry.result = 0;
+            else if (strstr(line, "[0.5]")) entry.result = 1;
+            else    continue;
 
-        // Resolve FEN to a quiet position
-        boardFromFEN(thread->board, line, 0);
-        qsearch(thread, &thread->pv, -MATE, MATE, 0);
-        for (j = 0; j < thread->pv.length; ++j)
-            applyMove(thread->board, thread->pv.line[j], undo);
+            boardFromFEN(thread->board, line, 0);
 
-        // Determine the game phase based on remaining material
-        tes[i].phase = 24 - 4 * popcount(thread->board.pieces[QUEEN ])
-                          - 2 * popcount(thread->board.pieces[ROOK  ])
-                          - 1 * popcount(thread->board.pieces[BISHOP])
-                          - 1 * popcount(thread->board.pieces[KNIGHT]);
+            const char *score = strstr(line, "] ");
+            searchEval = score ? atoi(score + 2) : VALUE_NONE;
+            if (score && thread->board.turn == BLACK) searchEval *= -1;
+        }
 
-        // Compute phase factors for updating the gradients and
-        tes[i].factors[MG] = 1 - tes[i].phase / 24.0;
-        tes[i].factors[EG] = 0 + tes[i].phase / 24.0;
+        // Resolve FEN to a quiet position
+        qsearch(thread, -MATE, MATE, 0);
+        for (int j = 0; j < thread->pvs[0].length; ++j)
+            applyMove(thread->board, thread->pvs[0].line[j], undo);
 
-        // Finish the phase calculation for the evaluation
-        tes[i].phase = (tes[i].phase * 256 + 12) / 24.0;
+        // Determine the game phase based on remaining material
+        entry.phase = 24 - 4 * popcount(thread->board.pieces[QUEEN ])
+                         - 2 * popcount(thread->board.pieces[ROOK  ])
+                         - 1 * popcount(thread->board.pieces[BISHOP])
+                         - 1 * popcount(thread->board.pieces[KNIGHT]);
 
         // Vectorize the evaluation coefficients and save the eval
         // relative to WHITE. We must first clear the coeff vector.
         T = EmptyTrace;
-        tes[i].eval = evaluateBoard(thread->board);
-        if (thread->board.turn == BLACK) tes[i].eval *= -1;
+        double eval = evaluateBoard(thread->board, *nopktable, thread->mtable);
+        if (thread->board.turn == BLACK) eval *= -1;
         initCoefficients(coeffs);
 
-        // Weight the Static and Search evals
-        tes[i].eval = tes[i].eval * STATICWEIGHT
-                    +  searchEval * SEARCHWEIGHT;
+        // Weight the Static and Search evals, when there was a search
+        if (searchEval == VALUE_NONE) searchEval = eval;
+        entry.eval = eval * STATICWEIGHT + searchEval * SEARCHWEIGHT;
 
         // Count up the non zero coefficients
-        for (k = 0, j = 0; j < NTERMS; ++j)
-            k += coeffs[j] != 0;
+        entry.ntuples = 0;
+        for (int j = 0; j < NTERMS; ++j)
+            entry.ntuples += coeffs[j] != 0;
+
+        // Write out a full block when this entry would not fit
+        if (used + sizeof(TexelEntry) + entry.ntuples * sizeof(TexelTuple) > BLOCKSIZE) {
+            memcpy(block.data(), &count, sizeof(uint32_t));
+            fwrite(block.data(), BLOCKSIZE, 1, fout);
+            memset(block.data(), 0, BLOCKSIZE);
+            used = sizeof(uint32_t), count = 0, header.blocks++;
+        }
 
-        // Allocate Tuples
-        updateMemory(&tes[i], k);
+        // Save the entry, followed by its Texel Tuples
+        memcpy(&block[used], &entry, sizeof(TexelEntry));
+        used += sizeof(TexelEntry);
 
-        // Initialize the Texel Tuples
-        for (k = 0, j = 0; j < NTERMS; ++j) {
-            if (coeffs[j] != 0){
-                tes[i].tuples[k].index = j;
-                tes[i].tuples[k++].coeff = coeffs[j];
+        for (int j = 0; j < NTERMS; ++j) {
+            if (coeffs[j] != 0) {
+                const TexelTuple tuple = { int16_t(j), int16_t(coeffs[j]) };
+                memcpy(&block[used], &tuple, sizeof(TexelTuple));
+                used += sizeof(TexelTuple);
             }
         }
+
+        // Occasional reporting for total completion
+        if (++header.positions % 10000 == 0)
+            cout << "\rBUILDING COEFFICIENT FILE " << path << " FROM " << dataset << "...  [" << header.positions << "]";
+        count++;
     }
 
-    fclose(fin);
+    if (count) {
+        memcpy(block.data(), &count, sizeof(uint32_t));
+        fwrite(block.data(), BLOCKSIZE, 1, fout);
+        header.blocks++;
+    }
+
+    fseek(fout, 0, SEEK_SET);
+    fwrite(&header, sizeof(TexelHeader), 1, fout);
+    fclose(fout);
+
+    if (binary) closePackedFile(packed);
+    else fclose(fin);
+
+    delete nopktable;
+}
+
+int openTexelFile(TexelFile& file, const char *path, const char *dataset) {
+
+    uint64_t bytes; int64_t time;
+
+    file = TexelFile();
+
+    if (!mapFile(path, file.buffer, file.bytes))
+        return 0;
+
+    // Files built by another version of the tuner, or from another version
+    // of the dataset, are rejected to be rebuilt
+    const TexelHeader *header = (const TexelHeader*)file.buffer;
+
+    if (   file.bytes < sizeof(TexelHeader)
+        || header->magic != TexelMagic
+        || header->nterms != NTERMS
+        || header->blocksize != BLOCKSIZE
+        || file.bytes != sizeof(TexelHeader) + header->blocks * BLOCKSIZE
+        || !statTexelDataset(dataset, bytes, time)
+        || header->datasetBytes != bytes
+        || header->datasetTime != time) {
+        closeTexelFile(file);
+        return 0;
+    }
+
+    file.data      = (const char*)file.buffer + sizeof(TexelHeader);
+    file.positions = header->positions;
+    file.blocks    = header->blocks;
+    return 1;
+}
+
+void closeTexelFile(TexelFile& file) {
+    unmapFile(file.buffer, file.bytes);
+    file = TexelFile();
 }
 
 void initCoefficients(int coeffs[NTERMS]) {
@@ -280,69 +400,89 @@ void initPhaseManager(TexelVector phases) {
     }
 }
 
-void updateMemory(TexelEntry *te, int size) {
+uint64_t updateGradient(TexelFile& file, const uint32_t *order, uint64_t first, uint64_t last,
+                        TexelAccumulator *accumulators, TexelVector gradient, TexelVector params, TexelVector phases, double K) {
 
-    // First ensure we have enough Tuples left for this TexelEntry
-    if (size > TupleStackSize) {
-        cout << "\n\nALLOCATING MEMORY FOR TEXEL TUPLE STACK [" << int(STACKSIZE * sizeof(TexelTuple) / (1024 * 1024)) << "MB]...\n\n";
-        TupleStackSize = STACKSIZE;
-        TupleStack = calloc(STACKSIZE, sizeof(TexelTuple));
+    uint64_t positions = 0;
+
+    #pragma omp parallel reduction(+:positions)
+    {
+        TexelAccumulator& local = accumulators[omp_get_thread_num()];
+
+        #pragma omp for schedule(dynamic)
+        for (uint64_t block = first; block < last; ++block) {
+
+            const uint32_t count = texelBlockCount(file, order[block]);
+            const TexelEntry *te = (const TexelEntry*)(texelBlock(file, order[block]) + sizeof(uint32_t));
+
+            for (uint32_t i = 0; i < count; ++i, te = nextTexelEntry(te)) {
+
+                const TexelTuple *tuples = texelTuples(*te);
+                const double error = singleLinearError(*te, params, K);
+                const double factors[PHASE_NB] = { 1 - te->phase / 24.0, te->phase / 24.0 };
+
+                for (int j = 0; j < te->ntuples; ++j) {
+
+                    const int index = tuples[j].index;
+
+                    if (!local.seen[index])
+                        local.seen[index] = true, local.touched[local.ntouched++] = index;
+
+                    for (int k = MG; k <= EG; ++k)
+                        local.values[index][k] += error * factors[k] * tuples[j].coeff;
+                }
+            }
+
+            positions += count;
+        }
     }
 
-    // Allocate Tuples for the given TexelEntry
-    te->tuples = TupleStack;
-    te->ntuples = size;
+    // Reduce the accumulators into the gradient, clearing them as we go
+    for (int t = 0; t < omp_get_max_threads(); ++t) {
 
-    // Update internal memory manager
-    TupleStack += size;
-    TupleStackSize -= size;
-}
+        TexelAccumulator& local = accumulators[t];
 
-void updateGradient(TexelEntry *tes, TexelVector gradient, TexelVector params, TexelVector phases, double K, int batch) {
+        for (int n = 0; n < local.ntouched; ++n) {
 
-    #pragma omp parallel shared(gradient)
-    {
-        TexelVector local = {0};
-        #pragma omp for schedule(static, BATCHSIZE / NPARTITIONS)
-        for (int i = batch * BATCHSIZE; i < (batch + 1) * BATCHSIZE; ++i) {
+            const int i = local.touched[n];
 
-            double error = singleLinearError(tes[i], params, K);
+            for (int j = MG; j <= EG; ++j) {
+                if (phases[i][j]) gradient[i][j] += local.values[i][j];
+                local.values[i][j] = 0.0;
+            }
 
-            for (int j = 0; j < tes[i].ntuples; ++j)
-                for (int k = MG; k <= EG; ++k)
-                    local[tes[i].tuples[j].index][k] += error * tes[i].factors[k] * tes[i].tuples[j].coeff;
+            local.seen[i] = false;
         }
 
-        for (int i = 0; i < NTERMS; ++i)
-            for (int j = MG; j <= EG; ++j)
-                if (phases[i][j]) gradient[i][j] += local[i][j];
+        local.ntouched = 0;
     }
+
+    return positions;
 }
 
-void shuffleTexelEntries(TexelEntry *tes) {
+void shuffleTexelBlocks(uint32_t *order, uint64_t blocks) {
 
-    for (int i = 0; i < NPOSITIONS; ++i) {
+    for (uint64_t i = blocks; i > 1; --i) {
 
-        int A = rand64() % NPOSITIONS;
-        int B = rand64() % NPOSITIONS;
+        const uint64_t j = rand64() % i;
 
-        TexelEntry temp = tes[A];
-        tes[A] = tes[B];
-        tes[B] = temp;
+        uint32_t temp = order[i-1];
+        order[i-1] = order[j];
+        order[j] = temp;
     }
 }
 
-double computeOptimalK(TexelEntry *tes) {
+double computeOptimalK(TexelFile& file) {
 
     double start = -10.0, end = 10.0, delta = 1.0;
-    double curr = start, error, best = completeEvaluationError(tes, start);
+    double curr = start, error, best = completeEvaluationError(file, start);
 
     for (int i = 0; i < KPRECISION; ++i) {
 
         curr = start - delta;
         while (curr < end) {
             curr = curr + delta;
-            error = completeEvaluationError(tes, curr);
+            error = completeEvaluationError(file, curr);
             if (error <= best)
                 best = error, start = curr;
         }
@@ -357,50 +497,58 @@ double computeOptimalK(TexelEntry *tes) {
     return start;
 }
 
-double completeEvaluationError(TexelEntry *tes, double K) {
+double completeEvaluationError(TexelFile& file, double K) {
 
     double total = 0.0;
 
-    #pragma omp parallel shared(total)
-    {
-        #pragma omp for schedule(static, NPOSITIONS / NPARTITIONS) reduction(+:total)
-        for (int i = 0; i < NPOSITIONS; ++i)
-            total += pow(tes[i].result - sigmoid(K, tes[i].eval), 2);
+    #pragma omp parallel for schedule(dynamic) reduction(+:total)
+    for (uint64_t block = 0; block < file.blocks; ++block) {
+
+        const uint32_t count = texelBlockCount(file, block);
+        const TexelEntry *te = (const TexelEntry*)(texelBlock(file, block) + sizeof(uint32_t));
+
+        for (uint32_t i = 0; i < count; ++i, te = nextTexelEntry(te))
+            total += pow(te->result / 2.0 - sigmoid(K, te->eval), 2);
     }
 
-    return total / (double)NPOSITIONS;
+    return total / (double)file.positions;
 }
 
-double completeLinearError(TexelEntry *tes, TexelVector params, double K) {
+double completeLinearError(TexelFile& file, TexelVector params, double K) {
 
     double total = 0.0;
 
-    #pragma omp parallel shared(total)
-    {
-        #pragma omp for schedule(static, NPOSITIONS / NPARTITIONS) reduction(+:total)
-        for (int i = 0; i < NPOSITIONS; ++i)
-            total += pow(tes[i].result - sigmoid(K, linearEvaluation(tes[i], params)), 2);
+    #pragma omp parallel for schedule(dynamic) reduction(+:total)
+    for (uint64_t block = 0; block < file.blocks; ++block) {
+
+        const uint32_t count = texelBlockCount(file, block);
+        const TexelEntry *te = (const TexelEntry*)(texelBlock(file, block) + sizeof(uint32_t));
+
+        for (uint32_t i = 0; i < count; ++i, te = nextTexelEntry(te))
+            total += pow(te->result / 2.0 - sigmoid(K, linearEvaluation(*te, params)), 2);
     }
 
-    return total / (double)NPOSITIONS;
+    return total / (double)file.positions;
 }
 
-double singleLinearError(TexelEntry& te, TexelVector params, double K) {
+double singleLinearError(const TexelEntry& te, TexelVector params, double K) {
     double sigm = sigmoid(K, linearEvaluation(te, params));
     double sigmprime = sigm * (1 - sigm);
-    return (te.result - sigm) * sigmprime;
+    return (te.result / 2.0 - sigm) * sigmprime;
 }
 
-double linearEvaluation(TexelEntry& te, TexelVector params) {
+double linearEvaluation(const TexelEntry& te, TexelVector params) {
 
     double mg = 0, eg = 0;
+    const TexelTuple *tuples = texelTuples(te);
+    const double phase = (te.phase * 256 + 12) / 24.0;
 
     for (int i = 0; i < te.ntuples; ++i) {
-        mg += te.tuples[i].coeff * params[te.tuples[i].index][MG];
-        eg += te.tuples[i].coeff * params[te.tuples[i].index][EG];
+        mg += tuples[i].coeff * params[tuples[i].index][MG];
+        eg += tuples[i].coeff * params[tuples[i].index][EG];
     }
 
-    return te.eval + ((mg * (256 - te.phase) + eg * te.phase) / 256.0);
+    return te.eval + ((mg * (256 - phase) + eg * phase) / 256.0);
 }
 
 double sigmoid(double K, double S) {
@@ -427,64 +575,62 @@ void printParameters(TexelVector params, TexelVector cparams) {
     }
 }
 
-void printParameters_0(char *name, int params[NTERMS][PHASE_NB], int i) {
-    cout << "const int " << name << " = S(" << params[i][MG] << "d," << params[i][EG] << "d);\n\n";
-    i++;
+void printParameters_0(const char *name, int params[NTERMS][PHASE_NB], int i) {
+    printf("const int %s = S(%4d,%4d);\n\n", name, params[i][MG], params[i][EG]);
 }
 
-void printParameters_1(char *name, int params[NTERMS][PHASE_NB], int i, int A) {
+void printParameters_1(const char *name, int params[NTERMS][PHASE_NB], int i, int A) {
 
-    cout << "const int " << name << "[" << A << "] = {";
+    printf("const int %s[%d] = {", name, A);
 
     for (int a = 0; a < A; a++, i++) {
-        if (a % 4 == 0) cout << "\n    ";
-        cout << "S(" << params[i][MG] << "d," << params[i][EG] << "d), ";
+        if (a % 4 == 0) printf("\n    ");
+        printf("S(%4d,%4d), ", params[i][MG], params[i][EG]);
     }
 
-    cout << "\n};\n\n";
+    printf("\n};\n\n");
 }
 
-void printParameters_2(char *name, int params[NTERMS][PHASE_NB], int i, int A, int B) {
+void printParameters_2(const char *name, int params[NTERMS][PHASE_NB], int i, int A, int B) {
 
-    cout << "const int " << name << "[" << A << "][" << B << "] = {\n";
+    printf("const int %s[%d][%d] = {\n", name, A, B);
 
     for (int a = 0; a < A; ++a) {
 
-        cout << "   {";
+        printf("   {");
 
         for (int b = 0; b < B; b++, i++) {
-            cout << "S(" << params[i][MG] << "d," << params[i][EG] << "d)";
-            cout << "%s, b == B - 1 ?  : , "
+            printf("S(%4d,%4d)", params[i][MG], params[i][EG]);
+            printf("%s", b == B - 1 ? "" : ", ");
         }
 
-        cout << "},\n";
+        printf("},\n");
     }
 
-    cout << "};\n\n";
-
+    printf("};\n\n");
 }
 
-void printParameters_3(char *name, int params[NTERMS][PHASE_NB], int i, int A, int B, int C) {
+void printParameters_3(const char *name, int params[NTERMS][PHASE_NB], int i, int A, int B, int C) {
 
-    cout << "const int " << name << "[" << A << "][" << B << "][" << C << "] = {\n";
+    printf("const int %s[%d][%d][%d] = {\n", name, A, B, C);
 
     for (int a = 0; a < A; ++a) {
 
         for (int b = 0; b < B; ++b) {
 
-            cout << "%s, b ?    { :   {{";
+            printf("%s", b ? "   {" : "  {{");
 
             for (int c = 0; c < C; c++, i++) {
-                cout << "S(" << params[i][MG] << "d," << params[i][EG] << "d)";
-                cout << "%s, c == C - 1 ?  : , "
+                printf("S(%4d,%4d)", params[i][MG], params[i][EG]);
+                printf("%s", c == C - 1 ? "" : ", ");
             }
 
-            cout << "%s, b == B - 1 ? }},\n : },\n"
+            printf("%s", b == B - 1 ? "}},\n" : "},\n");
         }
 
     }
 
-    cout << "};\n\n";
+    printf("};\n\n");
 }
 
 #endif
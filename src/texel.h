@@ -20,23 +20,78 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "types.h"
 
-#define NPARTITIONS  (     64) // Total thread partitions
+// Declared here, so that evaluate.cpp gives the terms external linkage
+
+extern const int PawnValue;
+extern const int KnightValue;
+extern const int BishopValue;
+extern const int RookValue;
+extern const int QueenValue;
+extern const int KingValue;
+extern const int PawnPSQT32[32];
+extern const int KnightPSQT32[32];
+extern const int BishopPSQT32[32];
+extern const int RookPSQT32[32];
+extern const int QueenPSQT32[32];
+extern const int KingPSQT32[32];
+extern const int PawnCandidatePasser[2][8];
+extern const int PawnIsolated;
+extern const int PawnStacked[2];
+extern const int PawnBackwards[2];
+extern const int PawnConnected32[32];
+extern const int KnightOutpost[2][2];
+extern const int KnightBehindPawn;
+extern const int ClosednessKnightAdjustment[9];
+extern const int KnightMobility[9];
+extern const int BishopPair;
+extern const int BishopRammedPawns;
+extern const int BishopOutpost[2][2];
+extern const int BishopBehindPawn;
+extern const int BishopMobility[14];
+extern const int RookFile[2];
+extern const int RookOnSeventh;
+extern const int ClosednessRookAdjustment[9];
+extern const int RookMobility[15];
+extern const int QueenMobility[28];
+extern const int KingDefenders[12];
+extern const int KingPawnFileProximity[8];
+extern const int KingShelter[2][8][8];
+extern const int KingStorm[2][4][8];
+extern const int PassedPawn[2][2][8];
+extern const int PassedFriendlyDistance[8];
+extern const int PassedEnemyDistance[8];
+extern const int PassedSafePromotionPath;
+extern const int ThreatWeakPawn;
+extern const int ThreatMinorAttackedByPawn;
+extern const int ThreatMinorAttackedByMinor;
+extern const int ThreatMinorAttackedByMajor;
+extern const int ThreatRookAttackedByLesser;
+extern const int ThreatMinorAttackedByKing;
+extern const int ThreatRookAttackedByKing;
+extern const int ThreatQueenAttackedByOne;
+extern const int ThreatOverloadedPieces;
+extern const int ThreatByPawnPush;
+extern const int ComplexityTotalPawns;
+extern const int ComplexityPawnFlanks;
+extern const int ComplexityPawnEndgame;
+extern const int ComplexityAdjustment;
+
 #define KPRECISION   (     10) // Iterations for computing K
 #define REPORTING    (     25) // How often to report progress
 #define NTERMS       (      0) // Total terms in the Tuner (625)
 
 #define LEARNING     (    5.0) // Learning rate
 #define LRDROPRATE   (   1.25) // Cut LR by this each failure
-#define BATCHSIZE    (7400000) // FENs per mini-batch
-#define NPOSITIONS   (7400000) // Total FENS in the book
+#define BATCHSIZE    (      0) // FENs per mini-batch, or 0 for the whole book
+#define BLOCKSIZE    (1 << 20) // Bytes per block of the Coefficient File
 
 #define STATICWEIGHT (   0.50) // Weight of the Static Evaluation
 #define SEARCHWEIGHT (   0.50) // Weight of the Depth 10 Search
 
-#define STACKSIZE (int((double) NPOSITIONS * NTERMS / 8))
-
 #define TunePawnValue                   (0)
 #define TuneKnightValue                 (0)
 #define TuneBishopValue                 (0)
@@ -93,43 +148,79 @@
 
 enum { NORMAL, MGONLY, EGONLY };
 
+// The Coefficient File holds a TexelEntry for each position, followed by
+// its non zero coefficients. Entries are grouped into blocks of BLOCKSIZE
+// bytes, which begin with a count of their entries, so that the tuner can
+// stream the file through memory and split the work between threads
+
 typedef struct TexelTuple {
-    int index;
-    int coeff;
+    int16_t index;
+    int16_t coeff;
 } TexelTuple;
 
 typedef struct TexelEntry {
-    int ntuples;
-    double result;
-    double eval, phase;
-    double factors[PHASE_NB];
-    TexelTuple *tuples;
+    float eval;           // Static and search evaluations, for WHITE
+    int8_t phase;         // From 0 in the opening, to 24 for bare Kings
+    uint8_t result;       // Half points scored by WHITE
+    uint16_t ntuples;     // TexelTuples which follow this entry
 } TexelEntry;
 
+typedef struct TexelHeader {
+    uint32_t magic, nterms;
+    uint64_t positions, blocks;
+    uint64_t blocksize;
+    uint64_t datasetBytes; // Size and modification time of the dataset,
+    int64_t datasetTime;   // so that a stale Coefficient File is rebuilt
+} TexelHeader;
+
+typedef struct TexelFile {
+    const char *data;     // The first block, just after the TexelHeader
+    uint64_t positions, blocks;
+    size_t bytes;
+    void *buffer;
+} TexelFile;
+
 typedef double TexelVector[NTERMS][PHASE_NB];
 
-void runTexelTuning(Thread *thread);
-void initTexelEntries(TexelEntry *tes, Thread *thread);
+// Gradients are summed by each thread for only the terms that it touched,
+// and then those terms alone are added into the total and cleared again.
+// The arrays keep one slot when there are no terms, to remain valid members
+
+typedef struct TexelAccumulator {
+    double values[MAX(NTERMS, 1)][PHASE_NB];
+    int touched[MAX(NTERMS, 1)], ntouched;
+    bool seen[MAX(NTERMS, 1)];
+} TexelAccumulator;
+
+static const uint32_t TexelMagic = 0x4C584554; // "TEXL"
+
+static_assert(sizeof(uint32_t) + sizeof(TexelEntry) + NTERMS * sizeof(TexelTuple) <= BLOCKSIZE,
+              "Every TexelEntry fits within a block");
+
+void runTexelTuning(Thread *thread, int argc, char **argv);
+void initTexelFile(const char *dataset, const char *path, Thread *thread);
+int openTexelFile(TexelFile& file, const char *path, const char *dataset);
+void closeTexelFile(TexelFile& file);
 void initCoefficients(int coeffs[NTERMS]);
 void initCurrentParameters(TexelVector cparams);
 void initPhaseManager(TexelVector phases);
 
-void updateMemory(TexelEntry *te, int size);
-void updateGradient(TexelEntry *tes, TexelVector gradient, TexelVector params, TexelVector phases, double K, int batch);
-void shuffleTexelEntries(TexelEntry *tes);
+uint64_t updateGradient(TexelFile& file, const uint32_t *order, uint64_t first, uint64_t last,
+                        TexelAccumulator *accumulators, TexelVector gradient, TexelVector params, TexelVector phases, double K);
+void shuffleTexelBlocks(uint32_t *order, uint64_t blocks);
 
-double computeOptimalK(TexelEntry *tes);
-double completeEvaluationError(TexelEntry *tes, double K);
-double completeLinearError(TexelEntry *tes, TexelVector params, double K);
-double singleLinearError(TexelEntry& te, TexelVector params, double K);
-double linearEvaluation(TexelEntry& te, TexelVector params);
+double computeOptimalK(TexelFile& file);
+double completeEvaluationError(TexelFile& file, double K);
+double completeLinearError(TexelFile& file, TexelVector params, double K);
+double singleLinearError(const TexelEntry& te, TexelVector params, double K);
+double linearEvaluation(const TexelEntry& te, TexelVector params);
 double sigmoid(double K, double S);
 
 void printParameters(TexelVector params, TexelVector cparams);
-void printParameters_0(char *name, int params[NTERMS][PHASE_NB], int i);
-void printParameters_1(char *name, int params[NTERMS][PHASE_NB], int i, int A);
-void printParameters_2(char *name, int params[NTERMS][PHASE_NB], int i, int A, int B);
-void printParameters_3(char *name, int params[NTERMS][PHASE_NB], int i, int A, int B, int C);
+void printParameters_0(const char *name, int params[NTERMS][PHASE_NB], int i);
+void printParameters_1(const char *name, int params[NTERMS][PHASE_NB], int i, int A);
+void printParameters_2(const char *name, int params[NTERMS][PHASE_NB], int i, int A, int B);
+void printParameters_3(const char *name, int params[NTERMS][PHASE_NB], int i, int A, int B, int C);
 
 // Initalize the Phase Manger which tracks the Term type
 
@@ -18,6 +18,8 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <new>
+#include <type_traits>
 
 #include "board.h"
 #include "history.h"
@@ -26,33 +28,62 @@
 #include "transposition.h"
 #include "types.h"
 
+extern int EvalCacheMegabytes; // Defined by Transposition.c
+
 Thread* createThreadPool(int nthreads) {
 
-	Thread *threads = new Thread[nthreads];
+	// Threads are released with free(), as destruction does nothing at all.
+	// Value-initialisation zeroes every member, including the pointers of the
+	// Eval Cache and the Repetition Stack, and the stacks which the root
+	// position looks back into. The largest tables come zeroed by calloc()
+	static_assert(std::is_trivially_destructible<Thread>::value, "Threads are released with free()");
+	Thread *threads = (Thread*)calloc(nthreads, sizeof(Thread));
 
 	for (int i = 0; i < nthreads; ++i) {
 
+		new (&threads[i]) Thread();
+
 		// Offset stacks so the root position may look backwards
 		threads[i].evalStack = &(threads[i]._evalStack[STACK_OFFSET]);
 		threads[i].moveStack = &(threads[i]._moveStack[STACK_OFFSET]);
 		threads[i].pieceStack = &(threads[i]._pieceStack[STACK_OFFSET]);
 
-		// Zero out the stacks, most importantly the first four slots
-		memset(&threads[i]._evalStack, 0, sizeof(int) * STACK_SIZE);
-		memset(&threads[i]._moveStack, 0, sizeof(uint16_t) * STACK_SIZE);
-		memset(&threads[i]._pieceStack, 0, sizeof(int) * STACK_SIZE);
-
 		// Threads will know of each other
 		threads[i].index = i;
 		threads[i].threads = threads;
 		threads[i].nthreads = nthreads;
-	}
 
-	resetThreadPool(threads);
+		// Each Thread owns a private Eval Cache, and Pawn King and Continuation
+		// tables. Only the Material Table marks its empty slots with non zeros
+		initEvalCache(threads[i].evcache, EvalCacheMegabytes);
+		threads[i].pktable = (PKTable*)calloc(1, sizeof(PKTable));
+		threads[i].continuation = (ContinuationTable*)calloc(1, sizeof(ContinuationTable));
+		clearMaterialTable(threads[i].mtable);
+	}
 
 	return threads;
 }
 
+void deleteThreadPool(Thread *threads) {
+
+	for (int i = 0; i < threads->nthreads; ++i) {
+		deleteEvalCache(threads[i].evcache);
+		deleteRepetitionStack(threads[i].repetitions);
+		free(threads[i].pktable);
+		free(threads[i].continuation);
+	}
+
+	free(threads);
+}
+
+void resizeEvalCacheThreadPool(Thread *threads, int megabytes) {
+
+	EvalCacheMegabytes = megabytes;
+
+	for (int i = 0; i < threads->nthreads; ++i)
+		initEvalCache(threads[i].evcache, megabytes);
+}
+
 void resetThreadPool(Thread *threads) {
 
 	// Reset the per-thread tables, used for move ordering
@@ -60,27 +91,34 @@ void resetThreadPool(Thread *threads) {
 	// calls in order to ensure a deterministic behaviour
 
 	for (int i = 0; i < threads->nthreads; ++i) {
-		memset(&threads[i].pktable.entries, 0, sizeof(PKEntry)*PKT_SIZE);
+		memset(threads[i].pktable->entries, 0, sizeof(PKEntry)*PKT_SIZE);
 		// fill(&threads[i].pktable, &threads[i].pktable+PKT_SIZE, PKTable);
 		memset(&threads[i].killers, 0, sizeof(KillerTable));
 		memset(&threads[i].cmtable, 0, sizeof(CounterMoveTable));
 		memset(&threads[i].history, 0, sizeof(HistoryTable));
-		memset(&threads[i].continuation, 0, sizeof(ContinuationTable));
+		memset(threads[i].continuation, 0, sizeof(ContinuationTable));
+		memset(&threads[i].chistory, 0, sizeof(CaptureHistoryTable));
+		clearEvalCache(threads[i].evcache);
+		clearMaterialTable(threads[i].mtable);
 	}
 }
 
-void newSearchThreadPool(Thread *threads, Board& board, Limits& limits, SearchInfo& info) {
+void newSearchThreadPool(Thread *threads, Board& board, const uint64_t *keys, Limits& limits, SearchInfo& info) {
 
 	// Initialize each Thread in the Thread Pool. We need a reference
 	// to the UCI seach parameters, access to the timing information,
 	// somewhere to store the results of each iteration by the main, and
-	// our own copy of the board. Also, we reset the seach statistics
+	// our own copy of the board. Also, we reset the seach statistics.
+	// Each Thread gets the game's keys, with room for a full search above
 
 	for (int i = 0; i < threads->nthreads; ++i) {
 		threads[i].limits = &limits;
 		threads[i].info = &info;
 		threads[i].nodes = threads[i].tbhits = 0ull;
+		threads[i].evalProbes = threads[i].evalHits = 0ull;
 		memcpy(&threads[i].board, &board, sizeof(Board));
+		reserveRepetitionStack(threads[i].repetitions, board.numMoves + MAX_PLY + 1);
+		if (board.numMoves) memcpy(threads[i].repetitions.keys, keys, sizeof(uint64_t) * board.numMoves);
 	}
 }
 
@@ -22,6 +22,7 @@
 #include <cstdint>
 
 #include "board.h"
+#include "movepicker.h"
 #include "search.h"
 #include "transposition.h"
 #include "types.h"
@@ -35,12 +36,13 @@ struct Limits {
 	double start, time, inc, mtg, timeLimit;
 	int limitedByNone, limitedByTime, limitedBySelf;
 	int limitedByDepth, depthLimit, multiPV;
+	int limitedByNodes, silent; // Nodes are counted by the main thread
+	uint64_t nodeLimit;
 };
 
 class Thread {
 public:
 	Board board;
-	PVariation pv;
 	Limits *limits;
 	SearchInfo *info;
 
@@ -51,17 +53,34 @@ public:
 
 	int depth, seldepth;
 	uint64_t nodes, tbhits;
+	uint64_t evalProbes, evalHits;
 
 	int *evalStack, _evalStack[STACK_SIZE];
 	uint16_t *moveStack, _moveStack[STACK_SIZE];
 	int *pieceStack, _pieceStack[STACK_SIZE];
 	Undo undoStack[STACK_SIZE];
+	RepetitionStack repetitions;
 
-	PKTable pktable;
+	// Move Pickers and Principal Variations by height, kept out of the search
+	// frames. The second picker is for the Singular Extension verification
+	MovePicker pickers[MAX_PLY+1][2];
+	PVariation pvs[MAX_PLY+1];
+
+	MaterialTable mtable;
+	EvalCache evcache;
 	KillerTable killers;
 	CounterMoveTable cmtable;
 	HistoryTable history;
-	ContinuationTable continuation;
+	CaptureHistoryTable chistory;
+
+	// The largest tables live apart from the Thread, allocated by calloc(),
+	// so that they start out zeroed without a pass over them
+	PKTable *pktable;
+	ContinuationTable *continuation;
+
+#ifdef PICKER_STATS
+	PickerStats pickerStats;
+#endif
 
 	int index, nthreads;
 	Thread *threads;
@@ -70,7 +89,9 @@ public:
 
 
 Thread* createThreadPool(int nthreads);
+void deleteThreadPool(Thread *threads);
+void resizeEvalCacheThreadPool(Thread *threads, int megabytes);
 void resetThreadPool(Thread *threads);
-void newSearchThreadPool(Thread *threads, Board& board, Limits& limits, SearchInfo& info);
+void newSearchThreadPool(Thread *threads, Board& board, const uint64_t *keys, Limits& limits, SearchInfo& info);
 uint64_t nodesSearchedThreadPool(Thread *threads);
 uint64_t tbhitsThreadPool(Thread *threads);
@@ -124,12 +124,15 @@ int terminateSearchEarly(Thread *thread) {
 	// Terminate the search early if the max usage time has passed.
 	// Only check this once for every 1024 nodes examined, in case
 	// the system calls are quite slow. Always be sure to avoid an
-	// early exit during a depth 1 search, to ensure a best move
+	// early exit during a depth 1 search, to ensure a best move.
+	// Node limits are exact, and apply to the main thread's count
 
 	const Limits *limits = thread->limits;
 
 	return  thread->depth > 1
-		&& (thread->nodes & 1023) == 1023
-		&& (limits->limitedBySelf || limits->limitedByTime)
-		&&  elapsedTime(*thread->info) >= thread->info->maxUsage;
+		&& (   (   (thread->nodes & 1023) == 1023
+				&& (limits->limitedBySelf || limits->limitedByTime)
+				&&  elapsedTime(*thread->info) >= thread->info->maxUsage)
+			|| (   limits->limitedByNodes && thread->index == 0
+				&& thread->nodes >= limits->nodeLimit));
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "types.h"
 
 TTable Table; // Global Transposition Table
+int EvalCacheMegabytes = 2; // Per-thread Eval Cache size
 
 void initTT(uint64_t megabytes) {
 
@@ -46,9 +47,10 @@ void initTT(uint64_t megabytes) {
 
     // Allocate the TTBuckets and save the lookup mask
     Table.hashMask = (1ull << keySize) - 1u;
-    Table.buckets  = new TTBucket[1ull << keySize];
+    Table.buckets  = (TTBucket*)calloc(1ull << keySize, sizeof(TTBucket));
 
-    clearTT(); // Clear the table and load everything into the cache
+    // The pages from calloc() are zeroed, and mapped lazily by the OS as the
+    // search first touches them, so there is no need to clear the table here
 }
 
 void updateTT() {
@@ -163,3 +165,51 @@ void storeTTEntry(uint64_t hash, uint16_t move, int value, int eval, int depth,
     replace.move       = move;
     replace.hash16     = hash16;
 }
+
+void clearMaterialTable(MaterialTable& table) {
+    for (MaterialEntry& entry : table.entries)
+        entry.materialKey = ~0ull;
+}
+
+void initEvalCache(EvalCache& cache, uint64_t megabytes) {
+
+    uint64_t keySize = 0ull;
+
+    // Cleanup memory when resizing the cache
+    deleteEvalCache(cache);
+
+    // A size of zero disables the cache. Otherwise, use the
+    // largest power of two number of entries which will fit
+    if (megabytes == 0) return;
+    for (;1ull << (keySize + 3) <= megabytes << 20; ++keySize);
+    keySize = keySize - 1;
+
+    cache.hashMask = (1ull << keySize) - 1u;
+    cache.entries  = (uint64_t*)calloc(1ull << keySize, sizeof(uint64_t));
+}
+
+void clearEvalCache(EvalCache& cache) {
+    if (cache.entries)
+        memset(cache.entries, 0, sizeof(uint64_t) * (cache.hashMask + 1u));
+}
+
+void deleteEvalCache(EvalCache& cache) {
+    free(cache.entries);
+    cache.entries  = nullptr;
+    cache.hashMask = 0ull;
+}
+
+int getEvalCacheEntry(EvalCache& cache, uint64_t hash, int *eval) {
+
+    const uint64_t entry = cache.entries[hash & cache.hashMask];
+
+    // The low 16 bits of the entry are the eval, the rest is the signature
+    if ((entry ^ hash) & ~0xFFFFull) return 0;
+
+    *eval = (int16_t)(entry & 0xFFFF);
+    return 1;
+}
+
+void storeEvalCacheEntry(EvalCache& cache, uint64_t hash, int eval) {
+    cache.entries[hash & cache.hashMask] = (hash & ~0xFFFFull) | (uint16_t)eval;
+}
@@ -59,12 +59,19 @@ struct TTable {
 	uint8_t generation;
 };
 
+// Everything in a PKEntry depends only on the Pawns and Kings, so that a hit
+// lets initEvalInfo() skip the pawn structure setup as well as the PK terms
 struct PKEntry {
 	uint64_t pkhash;
 	uint64_t passed;
+	uint64_t pawnAttacks[COLOUR_NB];
+	uint64_t rammedPawns[COLOUR_NB];
 	int eval;
+	uint8_t closedness;
 };
 
+static_assert(sizeof(PKEntry) <= 64, "PKEntry must fit in a cache line");
+
 struct PKTable {
 	PKEntry entries[PKT_SIZE];
 	PKTable(){};
@@ -72,6 +79,30 @@ struct PKTable {
 	bool nul=0;
 };
 
+enum {
+	MT_KEY_SIZE = 11,
+	MT_SIZE     = 1 << MT_KEY_SIZE,
+};
+
+// Everything in a MaterialEntry depends only on the material signature. The
+// counters of a materialKey fill 40 bits, so an empty slot is marked by ~0ull
+struct MaterialEntry {
+	uint64_t materialKey;
+	const Endgame *endgame;
+	int phase, scaling;
+};
+
+struct MaterialTable {
+	MaterialEntry entries[MT_SIZE];
+};
+
+// Direct mapped cache of evaluateBoard() results. The upper 48 bits of the
+// full hash are kept for verification, and the low 16 bits hold the eval
+struct EvalCache {
+	uint64_t *entries;
+	uint64_t hashMask;
+};
+
 void initTT(uint64_t megabytes);
 void updateTT();
 void clearTT();
@@ -80,3 +111,11 @@ int valueFromTT(int value, int height);
 int valueToTT(int value, int height);
 int getTTEntry(uint64_t hash, uint16_t *move, int *value, int *eval, int *depth, int *bound);
 void storeTTEntry(uint64_t hash, uint16_t move, int value, int eval, int depth, int bound);
+
+void clearMaterialTable(MaterialTable& table);
+
+void initEvalCache(EvalCache& cache, uint64_t megabytes);
+void clearEvalCache(EvalCache& cache);
+void deleteEvalCache(EvalCache& cache);
+int getEvalCacheEntry(EvalCache& cache, uint64_t hash, int *eval);
+void storeEvalCacheEntry(EvalCache& cache, uint64_t hash, int eval);
@@ -77,7 +77,11 @@ typedef struct TTBucket TTBucket;
 typedef struct TTable TTable;
 typedef struct PKEntry PKEntry;
 typedef struct PKTable PKTable;
+typedef struct MaterialEntry MaterialEntry;
+typedef struct MaterialTable MaterialTable;
+typedef struct Endgame Endgame;
 typedef struct Limits Limits;
+typedef struct PackedBoard PackedBoard;
 typedef class UCIGoStruct UCIGoStruct;
 
 // Renamings, currently for move ordering
@@ -85,6 +89,7 @@ typedef uint16_t KillerTable[MAX_PLY+1][2];
 typedef uint16_t CounterMoveTable[COLOUR_NB][PIECE_NB][SQUARE_NB];
 typedef int16_t HistoryTable[COLOUR_NB][SQUARE_NB][SQUARE_NB];
 typedef int16_t ContinuationTable[CONT_NB][PIECE_NB][SQUARE_NB][PIECE_NB][SQUARE_NB];
+typedef int16_t CaptureHistoryTable[PIECE_NB][SQUARE_NB][PIECE_NB+1];
 
 namespace {
 inline int pieceType(int piece) {
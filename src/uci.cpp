@@ -16,6 +16,7 @@
 	along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cctype>
 #include <cinttypes>
 #include <pthread.h>
 #include <cstdint>
@@ -24,12 +25,16 @@
 
 #include "attacks.h"
 #include "board.h"
+#include "endgame.h"
 #include "evaluate.h"
 #include "fathom/tbprobe.h"
+#include "gensfen.h"
 #include "history.h"
 #include "masks.h"
 #include "move.h"
 #include "movegen.h"
+#include "packed.h"
+#include "perft.h"
 #include "search.h"
 #include "texel.h"
 #include "thread.h"
@@ -40,6 +45,7 @@
 #include "zobrist.h"
 
 extern int MoveOverhead;          // Defined by Time.c
+extern int EvalCacheMegabytes;    // Defined by Transposition.c
 extern unsigned TB_PROBE_DEPTH;   // Defined by Syzygy.c
 extern volatile int ABORT_SIGNAL; // Defined by Search.c
 extern volatile int IS_PONDERING; // Defined by Search.c
@@ -64,12 +70,14 @@ void *uciGo(void *cargo) {
 	char moveStr[6];
 
 	int depth = 0, infinite = 0;
+	uint64_t nodes = 0;
 	double wtime = 0, btime = 0, movetime = 0, winc = 0, binc = 0,
 	mtg = -1;
 
 	int multiPV     = ((UCIGoStruct*)cargo)->multiPV;
 	string str       = ((UCIGoStruct*)cargo)->str;
 	Board board    = ((UCIGoStruct*)cargo)->board;
+	const uint64_t *keys = ((UCIGoStruct*)cargo)->keys;
 	Thread *threads = ((UCIGoStruct*)cargo)->threads;
 
 	// Grab the ready lock, as we cannot be ready until we finish this search
@@ -88,6 +96,7 @@ void *uciGo(void *cargo) {
 		else if (w=="movestogo") mtg = stoi(parse(str,w));
 		else if (w=="depth") depth = stoi(parse(str,w));
 		else if (w=="movetime") movetime = stoi(parse(str,w));
+		else if (w=="nodes") nodes = stoull(parse(str,w));
 		else if (w=="infinite") infinite = 1;
 		else if (w=="ponder") IS_PONDERING = 1;
 	}
@@ -96,9 +105,12 @@ void *uciGo(void *cargo) {
 	limits.limitedByNone  = infinite != 0;
 	limits.limitedByTime  = movetime != 0;
 	limits.limitedByDepth = depth    != 0;
-	limits.limitedBySelf  = !depth && !movetime && !infinite;
+	limits.limitedByNodes = nodes    != 0;
+	limits.limitedBySelf  = !depth && !movetime && !infinite && !nodes;
 	limits.timeLimit      = movetime;
 	limits.depthLimit     = depth;
+	limits.nodeLimit      = nodes;
+	limits.silent         = 0;
 
 	// Pick the time values for the colour we are playing as
 	limits.start = start;
@@ -109,8 +121,11 @@ void *uciGo(void *cargo) {
 	// Limit MultiPV to the number of legal moves
 	limits.multiPV = MIN(multiPV, legalMoveCount(board));
 
-	// Execute search, return best and ponder moves
-	getBestMove(threads, board, limits, bestMove, ponderMove);
+	// Execute search, return best and ponder moves. The Table has an age
+	// component, and the signal must be cleared or the Threads will exit
+	updateTT();
+	ABORT_SIGNAL = 0;
+	getBestMove(threads, board, keys, limits, bestMove, ponderMove);
 
 	// UCI spec does not want reports until out of pondering
 	while (IS_PONDERING);
@@ -134,16 +149,18 @@ void *uciGo(void *cargo) {
 	return nullptr;
 }
 
-void uciSetOption(string& str, Thread *threads, int& multiPV, int& chess960) {
+void uciSetOption(string& str, Thread *&threads, int& multiPV, int& chess960) {
 
 	// Handle setting UCI options in Ethereal. Options include:
 	//  Hash             : Size of the Transposition Table in Megabyes
 	//  Threads          : Number of search threads to use
+	//  EvalCache        : Size of each Thread's Eval Cache in Megabytes
 	//  MultiPV          : Number of search lines to report per iteration
 	//  MoveOverhead     : Overhead on time allocation to avoid time losses
 	//  SyzygyPath       : Path to Syzygy Tablebases
 	//  SyzygyProbeDepth : Minimal Depth to probe the highest cardinality Tablebase
 	//  UCI_Chess960     : Set when playing FRC, but not required in order to work
+	//  ZobristSeed      : Seed of the Zobrist keys, or zero for the usual keys
 
 	if (equStart(str, "setoption name Hash value ", nextr)) {
 		int megabytes = stoi(nextr);
@@ -152,10 +169,16 @@ void uciSetOption(string& str, Thread *threads, int& multiPV, int& chess960) {
 
 	if (equStart(str, "setoption name Threads value ", nextr)) {
 		int nthreads = stoi(nextr);
-		free(threads); threads = createThreadPool(nthreads);
+		deleteThreadPool(threads); threads = createThreadPool(nthreads);
 		cout << "info string set Threads to " << nthreads << "\n";
 	}
 
+	if (equStart(str, "setoption name EvalCache value ", nextr)) {
+		int megabytes = stoi(nextr);
+		resizeEvalCacheThreadPool(threads, megabytes);
+		cout << "info string set EvalCache to " << megabytes << "MB\n";
+	}
+
 	if (equStart(str, "setoption name MultiPV value ", nextr)) {
 		multiPV = stoi(nextr);
 		cout << "info string set MultiPV to " << multiPV << "\n";
@@ -181,15 +204,21 @@ void uciSetOption(string& str, Thread *threads, int& multiPV, int& chess960) {
 		else if (equStart(nextr, "false"))
 				cout << "info string set UCI_Chess960 to false\n", chess960 = 0;
 	}
+
+	// The tables hashed with the old keys are cleared. The Board and the keys
+	// of the game are rebuilt with the new keys by the next position command
+	if (equStart(str, "setoption name ZobristSeed value ", nextr)) {
+		uint64_t seed = stoull(nextr);
+		initZobrist(seed); clearTT(); resetThreadPool(threads);
+		cout << "info string set ZobristSeed to " << seed << "\n";
+	}
 	fflush(stdout);
 }
 
-void uciPosition(string& str, Board& board, int chess960) {
+void uciPosition(string& str, Board& board, RepetitionStack& game, int chess960) {
 
-	int size;
-	uint16_t moves[MAX_MOVES];
-	string moveStr(6,0), w(5,0);
-	char testStr[6];
+	uint16_t move;
+	const char *moves;
 	Undo undo;
 
 	// Position is defined by a FEN, X-FEN or Shredder-FEN
@@ -200,26 +229,26 @@ void uciPosition(string& str, Board& board, int chess960) {
 	else if (strContains(str, "startpos"))
 		boardFromFEN(board, StartPosition, chess960);
 
-	if (strContains(str, "moves ", nextr))
-		
-	// Apply each move in the move list. UCI sends moves in long algebraic notation
-		while (moveStr[4] =0, moveStr = parse(nextr, w), w.size() > 3) {
-
-			// Generate moves for this position
-			size = 0; genAllLegalMoves(board, moves, size);
-
-			// Find and apply the given move
-			for (int i = 0; i < size; ++i) {
-					moveToString(moves[i], testStr, board.chess960);
-					if (moveStr==testStr) {
-						applyMove(board, moves[i], undo);
-						break;
-					}
-			}
-			// Reset move history whenever we reset the fifty move rule. This way
-			// we can track all positions that are candidates for repetitions, and
-			// are still able to use a fixed size for the history array (512)
-			if (board.halfMoveCounter == 0)	board.numMoves = 0;
+	if (!(moves = strstr(str.c_str(), "moves ")))
+		return;
+
+	// Apply each move in the move list. UCI sends moves in long algebraic notation,
+	// which we read in place. Anything which is not a legal move ends the list
+	for (moves += 6; *moves; ) {
+
+		while (isspace(*moves)) moves++;
+		if (!*moves || (move = stringToMove(board, moves)) == NONE_MOVE)
+			break;
+
+		reserveRepetitionStack(game, board.numMoves + 1);
+		game.keys[board.numMoves] = board.hash;
+		applyMove(board, move, undo);
+
+		// Reset move history whenever we reset the fifty move rule. Positions
+		// before a zeroing move can never be repeated, so need not be kept
+		if (board.halfMoveCounter == 0) board.numMoves = 0;
+
+		while (*moves && !isspace(*moves)) moves++;
 	}
 }
 
@@ -254,9 +283,9 @@ void uciReport(Thread *threads, int alpha, int beta, int value) {
 	cout << "info depth " << depth << " seldepth " << seldepth << " multipv " << multiPV << " score " << type << " " << score << bound << "time " << elapsed << " nodes " << nodes << " nps " << nps << " tbhits " << tbhits << " hashfull " << hashfull << " pv ";
 
 	// Iterate over the PV and print each move
-	for (int i = 0; i < threads->pv.length; ++i) {
+	for (int i = 0; i < threads->pvs[0].length; ++i) {
 		char moveStr[6];
-		moveToString(threads->pv.line[i], moveStr, threads->board.chess960);
+		moveToString(threads->pvs[0].line[i], moveStr, threads->board.chess960);
 		cout << moveStr << " ";
 	}
 
@@ -295,6 +324,7 @@ void uciReportCurrentMove(Board& board, uint16_t move, int currmove, int depth)
 int main(int argc, char* argv[]) {
 
 	Board board;
+	RepetitionStack game = {};
 	string str(8192,0);
 	Thread *threads;
 	pthread_t pthreadsgo;
@@ -302,12 +332,12 @@ int main(int argc, char* argv[]) {
 
 	int chess960 = 0, multiPV  = 1;
 
-	// Initialize core components of Ethereal
-	initAttacks();
-	initMasks();
+	// Initialize core components of Ethereal. Attacks, masks and the KPK
+	// bitbase are generated at compile time, so only the cheap steps remain
 	initEval();
 	initSearch();
-	initZobrist();
+	initZobrist(0);
+	initEndgames();
 	initTT(16);
 	threads = createThreadPool(1);
 	boardFromFEN(board, StartPosition, chess960);
@@ -318,9 +348,59 @@ int main(int argc, char* argv[]) {
 		return 0;
 	}
 
+	// Allow timing of the evaluation terms from the command line
+	if (argc > 1 && string(argv[1])=="evalbench") {
+		runEvalBenchmark(argc, argv);
+		return 0;
+	}
+
+	// Allow timing of the slider attack lookups from the command line
+	if (argc > 1 && string(argv[1])=="attackbench") {
+		runAttackBenchmark(argc, argv);
+		return 0;
+	}
+
+	// Allow timing of the startup of Ethereal from the command line
+	if (argc > 1 && string(argv[1])=="startupbench") {
+		runStartupBenchmark(argc, argv);
+		return 0;
+	}
+
+	// Allow timing of FEN parsing and UCI move decoding from the command line
+	if (argc > 1 && string(argv[1])=="fenbench") {
+		runFENBenchmark(argc, argv);
+		return 0;
+	}
+
+	// Allow datasets to be converted between FENs and PackedBoards
+	if (argc > 1 && string(argv[1])=="fen2bin")
+		return runPackFENs(argc, argv);
+
+	if (argc > 1 && string(argv[1])=="bin2fen")
+		return runUnpackFENs(argc, argv);
+
+	if (argc > 1 && string(argv[1])=="binbench") {
+		runPackedBenchmark(argc, argv);
+		return 0;
+	}
+
+	// Allow datasets to be generated by self-play, in either format
+	if (argc > 1 && string(argv[1])=="gensfen")
+		return runGenerateFENs(argc, argv);
+
+	// Allow the quality of the Zobrist keys to be measured from the command line
+	if (argc > 1 && string(argv[1])=="zobristtest") {
+		runZobristTest(argc, argv);
+		return 0;
+	}
+
+	// Allow a suite of perft positions to be verified from the command line
+	if (argc > 1 && string(argv[1])=="perftsuite")
+		return runPerftSuite(argc, argv);
+
 	// Allow the tuner to be run when compiled
 	#ifdef TUNE
-		runTexelTuning(threads);
+		runTexelTuning(threads, argc, argv);
 		return 0;
 	#endif
 
@@ -330,12 +410,14 @@ int main(int argc, char* argv[]) {
 			cout << "id author Andrew Grant & Laldon\n";
 			cout << "option name Hash type spin default 16 min 1 max 65536\n";
 			cout << "option name Threads type spin default 1 min 1 max 2048\n";
+			cout << "option name EvalCache type spin default " << EvalCacheMegabytes << " min 0 max 1024\n";
 			cout << "option name MultiPV type spin default 1 min 1 max 256\n";
 			cout << "option name MoveOverhead type spin default 100 min 0 max 10000\n";
 			cout << "option name SyzygyPath type string default <empty>\n";
 			cout << "option name SyzygyProbeDepth type spin default 0 min 0 max 127\n";
 			cout << "option name Ponder type check default false\n";
 			cout << "option name UCI_Chess960 type check default false\n";
+			cout << "option name ZobristSeed type spin default 0 min 0 max 2147483647\n";
 			cout << "uciok\n", fflush(stdout);
 		}
 
@@ -348,12 +430,13 @@ int main(int argc, char* argv[]) {
 				uciSetOption(str, threads, multiPV, chess960);
 
 		else if (equStart(str, "position"))
-				uciPosition(str, board, chess960);
+				uciPosition(str, board, game, chess960);
 
 		else if (equStart(str, "go")) {
 				uciGoStruct.str.assign(str,0,511);
 				uciGoStruct.multiPV = multiPV;
 				uciGoStruct.board   = board;
+				uciGoStruct.keys    = game.keys;
 				uciGoStruct.threads = threads;
 				pthread_create(&pthreadsgo, nullptr, uciGo, &uciGoStruct);
 		}
@@ -365,10 +448,20 @@ int main(int argc, char* argv[]) {
 		}
 		else if (str=="quit")	break;
 
-		else if (equStart(str, "perft ", nextr))
-				cout << "%\n" << perft(board, stoi(nextr)), fflush(stdout);
+		else if (equStart(str, "perft ", nextr)) {
+				int depth = 0, megabytes = 0; // perft <depth> [megabytes]
+				sscanf(nextr.c_str(), "%d %d", &depth, &megabytes);
+				cout << "%\n" << perft(board, depth, threads->nthreads, megabytes) << "\n", fflush(stdout);
+		}
+		else if (equStart(str, "divide ", nextr)) {
+				int depth = 0, megabytes = 0; // divide <depth> [megabytes]
+				sscanf(nextr.c_str(), "%d %d", &depth, &megabytes);
+				perftDivide(board, depth, threads->nthreads, megabytes);
+		}
 		else if (equStart(str, "print"))
 				printBoard(board), fflush(stdout);
+		else if (str=="eval")
+				printEvaluation(board), fflush(stdout);
 	}
 	return 0;
 }
@@ -37,6 +37,7 @@ public:
 	int multiPV;
 	string str{string(512,0)};
 	Board board;
+	const uint64_t *keys;
 	Thread *threads;
 };
 void uciReport(Thread *threads, int alpha, int beta, int value);
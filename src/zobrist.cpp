@@ -16,8 +16,14 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <utility>
 
+#include "attacks.h"
+#include "bitboards.h"
+#include "move.h"
 #include "types.h"
 #include "zobrist.h"
 
@@ -25,36 +31,113 @@ uint64_t ZobristKeys[32][SQUARE_NB];
 uint64_t ZobristEnpassKeys[FILE_NB];
 uint64_t ZobristCastleKeys[SQUARE_NB];
 uint64_t ZobristTurnKey;
+uint64_t MaterialKeys[32];
+uint64_t CuckooKeys[CUCKOO_SIZE];
+uint16_t CuckooMoves[CUCKOO_SIZE];
 
-uint64_t rand64() {
+static uint64_t xorshift64star(uint64_t& state) {
 
     // http://vigna.di.unimi.it/ftp/papers/xorshift.pdf
 
-    static uint64_t seed = 1070372ull;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    return state * 2685821657736338717ull;
+}
+
+static uint64_t splitmix64(uint64_t& state) {
+
+    // http://xoshiro.di.unimi.it/splitmix64.c
+
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
 
-    seed ^= seed >> 12;
-    seed ^= seed << 25;
-    seed ^= seed >> 27;
+    return z ^ (z >> 31);
+}
 
-    return seed * 2685821657736338717ull;
+uint64_t rand64() {
+    static uint64_t seed = 1070372ull;
+    return xorshift64star(seed);
 }
 
-void initZobrist() {
+void initZobrist(uint64_t seed) {
+
+    // Seed zero gives the usual keys, from a fresh xorshift64* stream, so
+    // that they no longer depend on who else has called rand64(). Any other
+    // seed selects a splitmix64 stream, which is well mixed for every seed
+    uint64_t state = seed ? seed : 1070372ull;
+    auto next = [&]() { return seed ? splitmix64(state) : xorshift64star(state); };
 
     // Init the main Zobrist keys for all pieces
     for (int piece = PAWN; piece <= KING; ++piece)
         for (int sq = 0; sq < SQUARE_NB; ++sq)
             for (int colour = WHITE; colour <= BLACK; ++colour)
-                ZobristKeys[makePiece(piece, colour)][sq] = rand64();
+                ZobristKeys[makePiece(piece, colour)][sq] = next();
 
     // Init the Zobrist keys for each enpass file
     for (int file = 0; file < FILE_NB; ++file)
-        ZobristEnpassKeys[file] = rand64();
+        ZobristEnpassKeys[file] = next();
 
     // Init the Zobrist keys for each castle rook
     for (int sq = 0; sq < SQUARE_NB; ++sq)
-        ZobristCastleKeys[sq] = rand64();
+        ZobristCastleKeys[sq] = next();
 
     // Init the Zobrist key for side to move
-    ZobristTurnKey = rand64();
+    ZobristTurnKey = next();
+
+    // Material keys are not random. Each piece owns a 4-bit counter, so that the
+    // sum over all pieces is an exact material signature. Kings are not counted
+    for (int piece = PAWN; piece < KING; ++piece)
+        for (int colour = WHITE; colour <= BLACK; ++colour)
+            MaterialKeys[makePiece(piece, colour)] = 1ull << (4 * (2 * piece + colour));
+
+    initCuckoo();
+}
+
+void initCuckoo() {
+
+    int count = 0;
+
+    memset(CuckooKeys, 0, sizeof(CuckooKeys));
+    memset(CuckooMoves, 0, sizeof(CuckooMoves));
+
+    // Insert each move between a pair of squares, once per piece, displacing
+    // any key found in the way to its other slot until an empty one is found
+    for (int piece = KNIGHT; piece <= KING; ++piece) {
+        for (int colour = WHITE; colour <= BLACK; ++colour) {
+            for (int sq1 = 0; sq1 < SQUARE_NB; ++sq1) {
+                for (int sq2 = sq1 + 1; sq2 < SQUARE_NB; ++sq2) {
+
+                    uint64_t attacks = piece == KNIGHT ? knightAttacks(sq1)
+                                     : piece == BISHOP ? bishopAttacks(sq1, 0ull)
+                                     : piece == ROOK   ? rookAttacks(sq1, 0ull)
+                                     : piece == QUEEN  ? queenAttacks(sq1, 0ull)
+                                     :                   kingAttacks(sq1);
+                    if (!testBit(attacks, sq2)) continue;
+
+                    uint16_t move = MoveMake(sq1, sq2, NORMAL_MOVE);
+                    uint64_t key  = ZobristKeys[makePiece(piece, colour)][sq1]
+                                  ^ ZobristKeys[makePiece(piece, colour)][sq2]
+                                  ^ ZobristTurnKey;
+
+                    // A chain of displacements may cycle for an unlucky set of keys,
+                    // as a seed may give. We then drop the last key, which only means that one
+                    // upcoming repetition goes unnoticed
+                    for (int slot = cuckooH1(key), kicks = 0; move != NONE_MOVE; ++kicks) {
+                        if (kicks == CUCKOO_SIZE) break;
+                        std::swap(CuckooKeys[slot], key);
+                        std::swap(CuckooMoves[slot], move);
+                        slot = slot == cuckooH1(key) ? cuckooH2(key) : cuckooH1(key);
+                    }
+
+                    count++;
+                }
+            }
+        }
+    }
+
+    assert(count == 3668); (void) count;
 }
@@ -26,6 +26,23 @@ extern uint64_t ZobristKeys[32][SQUARE_NB];
 extern uint64_t ZobristEnpassKeys[FILE_NB];
 extern uint64_t ZobristCastleKeys[SQUARE_NB];
 extern uint64_t ZobristTurnKey;
+extern uint64_t MaterialKeys[32];
+
+// Cuckoo tables of the keys of every reversible move by a non-Pawn piece on
+// an empty board, used to find upcoming repetitions. Each key sits in one
+// of the two slots given by H1() and H2(), next to the move it came from
+
+enum { CUCKOO_SIZE = 8192 };
+
+extern uint64_t CuckooKeys[CUCKOO_SIZE];
+extern uint16_t CuckooMoves[CUCKOO_SIZE];
+
+inline int cuckooH1(uint64_t key) { return (key >>  0) & (CUCKOO_SIZE - 1); }
+inline int cuckooH2(uint64_t key) { return (key >> 16) & (CUCKOO_SIZE - 1); }
+
+// Seed zero selects Ethereal's usual keys, any other the keys of a splitmix64
+// stream started from that seed. Changing the keys voids all hashed tables
 
 uint64_t rand64();
-void initZobrist();
+void initZobrist(uint64_t seed);
+void initCuckoo();